@@ -0,0 +1,353 @@
+/* ============================================================
+   *File : editorbench.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Editor scenarios run on ghi without a terminal.
+   Usage: editorbench [-m MB] [-d dir] ghi [ghi ...]
+   A text of MB megabytes (100 by default) is made in dir (/tmp) once.
+   For each ghi binary and scenario a key script is written, ghi runs
+   with it as stdin, its frames go to /dev/null and with GHI_STATS it
+   gives what the run cost on stderr. One JSON line per run is printed:
+
+       {"build": "ghi-release", "scenario": "type", "ops": 100000,
+        "ns_per_op": ..., "allocs_per_op": ..., "peak_rss_kb": ...}
+
+   Scenarios: open the file, type mid-line, Enter at the top, page
+   down from top to end, search a word which is only on the last line.
+
+   Then each ghi saves a text where some lines end in \r\n in large
+   mode and in normal mode, unedited and after one key. Both saves
+   must give the same file.
+   ============================================================ */
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SCREEN "24x80"
+#define TEXT_ROWS 22 // Rows of SCREEN without status and message bar
+#define TYPE_CHARS 100000
+#define ENTER_KEYS 10000
+#define QUERY "QXZJQXZJ" // Not in the made text, only on its last line
+#define NEXT_KEYS 8      // Arrow down after the query, each one looks at all rows
+#define CHECK_MB 10      // Text of the save check, large mode from 1 MB on
+#define CHECK_CRLF 7     // Every this many lines of it ends in \r\n
+
+#define KEY_DOWN "\x1b[B"
+#define KEY_RIGHT "\x1b[C"
+#define KEY_PAGE_DOWN "\x1b[6~"
+
+typedef struct keys {
+    char *b;
+    size_t len;
+    size_t cap;
+} keys;
+
+static void put(keys *k, const char *s, size_t len) {
+    if(k->len + len > k->cap) {
+        k->cap = (k->len + len) * 2;
+        k->b = realloc(k->b, k->cap);
+        if(k->b == NULL) {
+            perror("editorbench");
+            exit(1);
+        }
+    }
+    memcpy(&k->b[k->len], s, len);
+    k->len += len;
+}
+
+static void putTimes(keys *k, const char *s, long n) {
+    for(long i = 0; i < n; i++)
+        put(k, s, strlen(s));
+}
+
+/* Make a text of size bytes at path, return its lines. It is put in
+ * place at the end so a stopped run leaves no half text */
+static long makeText(const char *path, size_t size) {
+    static const char *words[] = {
+        "xin", "chào", "thế", "giới", "tiếng", "Việt", "đường", "phố",
+        "người", "trường", "học", "sinh", "khoẻ", "quý", "giá", "nước",
+        "Nam", "và", "của", "những", "đây", "là", "the", "editor", "buffer",
+        "line", "text", "search", "memory", "file", "open", "save", "row"
+    };
+    char tmp[4096 + 8];
+    snprintf(tmp, sizeof(tmp), "%s.part", path);
+    FILE *fp = fopen(tmp, "w");
+    if(fp == NULL) return -1;
+    size_t n = 0, col = 0;
+    long lines = 0;
+    unsigned seed = 1;
+    while(n < size) {
+        seed = seed * 1103515245 + 12345;
+        const char *w = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        size_t wl = strlen(w);
+        fwrite(w, 1, wl, fp);
+        n += wl + 1;
+        col += wl + 1;
+        if(col > 60) {
+            fputc('\n', fp);
+            col = 0;
+            lines++;
+        } else {
+            fputc(' ', fp);
+        }
+    }
+    fputs("last line " QUERY "\n", fp);
+    lines++;
+    if(fclose(fp) != 0 || rename(tmp, path) != 0) return -1;
+    return lines;
+}
+
+/* Lines of the text at path, -1 when it is not there */
+static long countLines(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if(fp == NULL) return -1;
+    char buf[1 << 16];
+    size_t n;
+    long lines = 0;
+    while((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        for(size_t i = 0; i < n; i++)
+            lines += buf[i] == '\n';
+    }
+    fclose(fp);
+    return lines;
+}
+
+/* First CHECK_MB of text to path, every CHECK_CRLF line ends in \r\n */
+static int makeCrlfText(const char *text, const char *path) {
+    FILE *in = fopen(text, "r");
+    FILE *out = fopen(path, "w");
+    int c;
+    size_t n = 0;
+    long lines = 0;
+    if(in == NULL || out == NULL) {
+        if(in) fclose(in);
+        if(out) fclose(out);
+        return -1;
+    }
+    while((c = getc(in)) != EOF) {
+        if(c == '\n' && ++lines % CHECK_CRLF == 0) putc('\r', out);
+        putc(c, out);
+        if(++n >= (size_t)CHECK_MB << 20 && c == '\n') break;
+    }
+    fclose(in);
+    return fclose(out) == 0 ? 0 : -1;
+}
+
+static int copyFile(const char *from, const char *to) {
+    FILE *in = fopen(from, "r");
+    FILE *out = fopen(to, "w");
+    char buf[1 << 16];
+    size_t n;
+    int ok = in && out;
+    while(ok && (n = fread(buf, 1, sizeof(buf), in)) > 0)
+        ok = fwrite(buf, 1, n, out) == n;
+    if(in) fclose(in);
+    if(out && fclose(out) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+static int sameFile(const char *a, const char *b) {
+    FILE *fa = fopen(a, "r");
+    FILE *fb = fopen(b, "r");
+    int same = fa && fb;
+    int ca = 0;
+    while(same && ca != EOF) {
+        ca = getc(fa);
+        same = ca == getc(fb);
+    }
+    if(fa) fclose(fa);
+    if(fb) fclose(fb);
+    return same;
+}
+
+/* Keys of a scenario, return its ops */
+static long scenarioKeys(const char *name, long lines, keys *k) {
+    if(!strcmp(name, "open")) return 1;
+    if(!strcmp(name, "type")) {
+        static const char *phrase = "xin chào thế giới the quick brown fox ";
+        putTimes(k, KEY_DOWN, 10);
+        putTimes(k, KEY_RIGHT, 30);
+        const char *p = phrase;
+        for(long i = 0; i < TYPE_CHARS; i++) {
+            size_t n = 1;
+            while(p[n] && (p[n] & 0xC0) == 0x80) n++;
+            put(k, p, n);
+            p += n;
+            if(*p == '\0') p = phrase;
+        }
+        return TYPE_CHARS;
+    }
+    if(!strcmp(name, "enter")) {
+        putTimes(k, "\r", ENTER_KEYS);
+        return ENTER_KEYS;
+    }
+    if(!strcmp(name, "scroll")) {
+        long pages = lines / TEXT_ROWS + 1;
+        putTimes(k, KEY_PAGE_DOWN, pages);
+        return pages;
+    }
+    if(!strcmp(name, "search")) {
+        put(k, "\x06", 1);
+        put(k, QUERY, strlen(QUERY));
+        putTimes(k, KEY_DOWN, NEXT_KEYS);
+        put(k, "\r", 1);
+        return strlen(QUERY) + NEXT_KEYS;
+    }
+    return 0;
+}
+
+static long long field(const char *report, const char *name) {
+    char key[64];
+    snprintf(key, sizeof(key), "\"%s\":", name);
+    const char *p = strstr(report, key);
+    return p ? strtoll(p + strlen(key), NULL, 10) : -1;
+}
+
+/* Run ghi on text with keys at script, its report goes to out */
+static int runGhi(const char *ghi, const char *text, const char *script,
+                  char *out, size_t cap) {
+    int pipefd[2];
+    if(pipe(pipefd) == -1) return -1;
+    pid_t pid = fork();
+    if(pid == -1) return -1;
+    if(pid == 0) {
+        int in = open(script, O_RDONLY);
+        int null = open("/dev/null", O_WRONLY);
+        if(in == -1 || null == -1) _exit(127);
+        dup2(in, STDIN_FILENO);
+        dup2(null, STDOUT_FILENO);
+        dup2(pipefd[1], STDERR_FILENO);
+        close(pipefd[0]);
+        execl(ghi, ghi, text, (char *)NULL);
+        _exit(127);
+    }
+    close(pipefd[1]);
+    size_t len = 0;
+    ssize_t n;
+    while(len + 1 < cap && (n = read(pipefd[0], &out[len], cap - len - 1)) > 0)
+        len += n;
+    out[len] = '\0';
+    close(pipefd[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+
+/* Save a copy of the \r\n text after keys in large mode and in normal
+ * mode, 1 when both files are the same, -1 when a run failed */
+static int checkSave(const char *ghi, const char *crlf, const char *dir,
+                     const char *script, const char *keys) {
+    char path[2][4096], report[1024];
+    for(int large = 0; large < 2; large++) {
+        snprintf(path[large], sizeof(path[large]), "%s/editorbench-save%d.txt", dir, large);
+        FILE *fp = fopen(script, "wb");
+        if(fp == NULL) return -1;
+        int ok = fputs(keys, fp) != EOF;
+        if(fclose(fp) != 0 || !ok || copyFile(crlf, path[large]) == -1) return -1;
+        setenv("GHI_LARGE_MB", large ? "1" : "0", 1);
+        if(runGhi(ghi, path[large], script, report, sizeof(report)) == -1) return -1;
+    }
+    int same = sameFile(path[0], path[1]);
+    unlink(path[0]);
+    unlink(path[1]);
+    return same;
+}
+
+int main(int argc, char **argv) {
+    static const char *scenarios[] = {"open", "type", "enter", "scroll", "search"};
+    size_t mb = 100;
+    const char *dir = "/tmp";
+    int opt;
+    while((opt = getopt(argc, argv, "m:d:")) != -1) {
+        if(opt == 'm') mb = strtoul(optarg, NULL, 10);
+        else if(opt == 'd') dir = optarg;
+        else optind = argc + 1;
+    }
+    if(optind >= argc || mb == 0) {
+        fprintf(stderr, "Usage: editorbench [-m MB] [-d dir] ghi [ghi ...]\n");
+        return 1;
+    }
+
+    char text[4096], script[4096];
+    snprintf(text, sizeof(text), "%s/editorbench-%zumb.txt", dir, mb);
+    snprintf(script, sizeof(script), "%s/editorbench-keys", dir);
+    long lines = countLines(text);
+    if(lines < 0) {
+        fprintf(stderr, "Making %zu MB of text in %s\n", mb, text);
+        lines = makeText(text, mb << 20);
+    }
+    if(lines < 0) {
+        perror(text);
+        return 1;
+    }
+
+    setenv("GHI_STATS", "1", 1);
+    setenv("GHI_SIZE", SCREEN, 1);
+    unsetenv("GHI_INDEX");
+    unsetenv("GHI_INPUT");
+    unsetenv("GHI_NORM_OPEN");
+    unsetenv("GHI_NORM_SAVE");
+
+    int failed = 0;
+    for(int b = optind; b < argc; b++) {
+        const char *build = strrchr(argv[b], '/') ? strrchr(argv[b], '/') + 1 : argv[b];
+        for(size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+            keys k = {NULL, 0, 0};
+            long ops = scenarioKeys(scenarios[s], lines, &k);
+            FILE *fp = fopen(script, "wb");
+            if(fp == NULL || fwrite(k.b, 1, k.len, fp) != k.len || fclose(fp) != 0) {
+                perror(script);
+                return 1;
+            }
+            free(k.b);
+
+            char report[1024];
+            if(runGhi(argv[b], text, script, report, sizeof(report)) == -1 ||
+               field(report, "keys_ns") < 0) {
+                fprintf(stderr, "%s %s: run failed\n", build, scenarios[s]);
+                failed = 1;
+                continue;
+            }
+            int open = !strcmp(scenarios[s], "open");
+            long long ns = field(report, open ? "open_ns" : "keys_ns");
+            long long allocs = field(report, open ? "open_allocs" : "key_allocs");
+            long long poolAllocs = open ? 0 : field(report, "key_pool_allocs");
+            printf("{\"build\": \"%s\", \"scenario\": \"%s\", \"mb\": %zu, \"ops\": %ld, "
+                   "\"total_ns\": %lld, \"ns_per_op\": %.1f, \"allocs\": %lld, "
+                   "\"allocs_per_op\": %.2f, \"pool_allocs_per_op\": %.2f, "
+                   "\"peak_rss_kb\": %lld}\n",
+                   build, scenarios[s], mb, ops, ns, (double)ns / ops, allocs,
+                   (double)allocs / ops, (double)poolAllocs / ops,
+                   field(report, open ? "open_rss_kb" : "peak_rss_kb"));
+            fflush(stdout);
+        }
+    }
+
+    // Large mode saves spans of lines from the file, the result must not
+    // differ from a save of rows
+    static const char *checks[][2] = {{"none", "\x13"}, {"edit", "x\x13"}};
+    char crlf[4096];
+    snprintf(crlf, sizeof(crlf), "%s/editorbench-crlf.txt", dir);
+    if(makeCrlfText(text, crlf) == -1) {
+        perror(crlf);
+        return 1;
+    }
+    for(int b = optind; b < argc; b++) {
+        const char *build = strrchr(argv[b], '/') ? strrchr(argv[b], '/') + 1 : argv[b];
+        for(size_t c = 0; c < sizeof(checks) / sizeof(checks[0]); c++) {
+            int same = checkSave(argv[b], crlf, dir, script, checks[c][1]);
+            if(same == -1) fprintf(stderr, "%s large save: run failed\n", build);
+            if(same != 1) failed = 1;
+            printf("{\"build\": \"%s\", \"check\": \"large_save\", \"keys\": \"%s\", "
+                   "\"same\": %s}\n", build, checks[c][0], same == 1 ? "true" : "false");
+            fflush(stdout);
+        }
+    }
+    unlink(crlf);
+    unlink(script);
+    return failed;
+}
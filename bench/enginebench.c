@@ -0,0 +1,116 @@
+/* ============================================================
+   *File : enginebench.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Speed of the Telex engine in keystrokes per second.
+   Usage: enginebench [file]
+   Keys of the file (Telex text) are typed into a line like the
+   editor does: the engine sees the characters before the cursor and
+   changed ones are put back. Without file a text is made from common
+   words.
+   ============================================================ */
+#define _POSIX_C_SOURCE 200809L
+#include "../engine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define GEN_KEYS (16 << 20)
+#define MIN_KEYS (64L << 20) // Type at least this many keys
+#define LINE_MAX 4096
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static char *readFile(const char *path, size_t *len) {
+    FILE *fp = fopen(path, "rb");
+    if(!fp) return NULL;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = malloc(size + 1);
+    if(buf && fread(buf, 1, size, fp) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(fp);
+    *len = size;
+    return buf;
+}
+
+static char *makeText(size_t *len) {
+    static const char *words[] = {
+        "xin", "chaof", "theees", "giowis", "tieengs", "Vieetj", "dduwowngf",
+        "phoos", "nguwowif", "truwowngf", "hocj", "sinh", "khoer", "quys",
+        "gias", "nuwowcs", "Nam", "vaf", "cuar", "nhuwngx", "ddaay", "laf"
+    };
+    char *buf = malloc(GEN_KEYS);
+    size_t n = 0, col = 0;
+    unsigned seed = 1;
+    if(!buf) return NULL;
+    while(n + 32 < GEN_KEYS) {
+        seed = seed * 1103515245 + 12345;
+        const char *w = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        size_t wl = strlen(w);
+        memcpy(&buf[n], w, wl);
+        n += wl;
+        col += wl;
+        buf[n++] = col > 70 ? '\n' : ' ';
+        if(col > 70) col = 0;
+    }
+    *len = n;
+    return buf;
+}
+
+/* Type keys into a line, return characters typed in all lines */
+static long typeKeys(int method, const char *keys, size_t len) {
+    static unsigned line[LINE_MAX];
+    int n = 0;
+    long chars = 0;
+    geEdit e;
+    for(size_t i = 0; i < len; i++) {
+        unsigned key = (unsigned char)keys[i];
+        if(key == '\n' || n == LINE_MAX - 1) {
+            chars += n;
+            n = 0;
+            continue;
+        }
+        int from = n > GE_MAX_WORD ? n - GE_MAX_WORD - 1 : 0;
+        if(geKey(method, &line[from], n - from, key, &e)) {
+            for(int k = 0; k < e.count; k++)
+                line[from + e.at[k]] = e.cp[k];
+            if(e.append) line[n++] = e.append;
+        } else {
+            line[n++] = key;
+        }
+    }
+    return chars + n;
+}
+
+int main(int argc, char **argv) {
+    size_t len;
+    char *keys = argc > 1 ? readFile(argv[1], &len) : makeText(&len);
+    if(!keys) {
+        perror("enginebench");
+        return 1;
+    }
+
+    printf("%zu keys\n", len);
+    for(int m = GE_OFF; m < GE_METHODS; m++) {
+        int reps = MIN_KEYS / len + 1;
+        long chars = 0;
+        double t = now();
+        for(int i = 0; i < reps; i++)
+            chars += typeKeys(m, keys, len);
+        t = now() - t;
+        printf("%-6s %8.2f M keys/s  (%ld characters)\n", geName(m),
+               (double)len * reps / t / 1e6, chars / reps);
+    }
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* ============================================================
+   *File : searchbench.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Speed of search kernels in GB/s.
+   Usage: searchbench [file] [query]
+   Without file a text of mixed ASCII and Vietnamese lines is made.
+   Query should not be in the text so the whole text is scanned,
+   once as one block and once line by line like the editor does.
+   ============================================================ */
+#define _GNU_SOURCE
+#include "../search.h"
+#include "../utf8.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define GEN_SIZE (256 << 20)
+#define MIN_BYTES (1L << 30) // Scan at least this much per test
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static char *readFile(const char *path, size_t *len) {
+    FILE *fp = fopen(path, "rb");
+    if(!fp) return NULL;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = malloc(size + 1);
+    if(buf && fread(buf, 1, size, fp) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(fp);
+    *len = size;
+    return buf;
+}
+
+static char *makeText(size_t *len) {
+    static const char *words[] = {
+        "the", "quick", "brown", "fox", "markdown", "# heading", "- item",
+        "xin", "chào", "thế", "giới", "tiếng", "Việt", "đường", "phố"
+    };
+    char *buf = malloc(GEN_SIZE);
+    size_t n = 0, col = 0;
+    unsigned seed = 1;
+    if(!buf) return NULL;
+    while(n + 32 < GEN_SIZE) {
+        seed = seed * 1103515245 + 12345;
+        const char *w = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        size_t wl = strlen(w);
+        memcpy(&buf[n], w, wl);
+        n += wl;
+        col += wl;
+        buf[n++] = col > 70 ? '\n' : ' ';
+        if(col > 70) col = 0;
+    }
+    *len = n;
+    return buf;
+}
+
+/* Whole text as one block */
+static long scanBlock(const searchPattern *p, const char *s, size_t len) {
+    return searchFind(p, s, len);
+}
+
+/* Line by line with each line split in the middle like a gap buffer */
+static long scanLines(const searchPattern *p, const char *s, size_t len) {
+    long found = 0;
+    const char *end = s + len;
+    while(s < end) {
+        const char *nl = memchr(s, '\n', end - s);
+        size_t l = nl ? (size_t)(nl - s) : (size_t)(end - s);
+        if(searchFindSplit(p, s, l / 2, s + l / 2, l - l / 2, 0) >= 0) found++;
+        s += l + 1;
+    }
+    return found;
+}
+
+static long scanMemmem(const searchPattern *p, const char *s, size_t len) {
+    const char *m = memmem(s, len, p->needle, p->len);
+    return m ? m - s : -1;
+}
+
+static void run(const char *name, long (*scan)(const searchPattern *, const char *, size_t),
+                const searchPattern *p, const char *s, size_t len) {
+    int reps = MIN_BYTES / len + 1;
+    long r = 0;
+    double t = now();
+    for(int i = 0; i < reps; i++)
+        r += scan(p, s, len);
+    t = now() - t;
+    printf("%-14s %8.2f GB/s  (%ld)\n", name, (double)len * reps / t / 1e9, r);
+}
+
+int main(int argc, char **argv) {
+    size_t len;
+    char *text = argc > 1 ? readFile(argv[1], &len) : makeText(&len);
+    const char *query = argc > 2 ? argv[2] : "ghi editor";
+    if(!text) {
+        perror("searchbench");
+        return 1;
+    }
+
+    searchPattern p;
+    searchCompile(&p, query, strlen(query));
+    printf("%zu bytes, query \"%s\"\n", len, query);
+
+    static const char *names[] = {"scalar", "sse2", "avx2"};
+    for(int k = UTF8_SCALAR; k <= UTF8_AVX2; k++) {
+        char name[32];
+        if(!searchSetKernel(k)) continue;
+        snprintf(name, sizeof(name), "%s", names[k]);
+        run(name, scanBlock, &p, text, len);
+        snprintf(name, sizeof(name), "%s lines", names[k]);
+        run(name, scanLines, &p, text, len);
+    }
+    run("memmem", scanMemmem, &p, text, len);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,297 @@
+/* ============================================================
+   *File : engine.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : A key is looked up in the table of its method, the
+   word before the cursor is split in letters (vowel, tone, case) and
+   parsed as consonants + vowels + final consonants:
+
+       "nguyeen" + s  ->  ng | uyê | n  ->  tone goes on ê  ->  nguyến
+
+   The action of the key changes the letters, then the tone is put
+   back on the vowel where it belongs and the letters which differ
+   from the text are given to the caller.
+   ============================================================ */
+#include "engine.h"
+
+#include <stddef.h>
+
+enum geVowel {
+    V_A = 0, V_AW, V_AA, // a ă â
+    V_E, V_EE,           // e ê
+    V_I,
+    V_O, V_OO, V_OW,     // o ô ơ
+    V_U, V_UW,           // u ư
+    V_Y,
+    VOWELS
+};
+
+/* Lower case vowels with tone: none, sắc, huyền, hỏi, ngã, nặng */
+static const unsigned short vowels[VOWELS][6] = {
+    {0x0061, 0x00E1, 0x00E0, 0x1EA3, 0x00E3, 0x1EA1},
+    {0x0103, 0x1EAF, 0x1EB1, 0x1EB3, 0x1EB5, 0x1EB7},
+    {0x00E2, 0x1EA5, 0x1EA7, 0x1EA9, 0x1EAB, 0x1EAD},
+    {0x0065, 0x00E9, 0x00E8, 0x1EBB, 0x1EBD, 0x1EB9},
+    {0x00EA, 0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5, 0x1EC7},
+    {0x0069, 0x00ED, 0x00EC, 0x1EC9, 0x0129, 0x1ECB},
+    {0x006F, 0x00F3, 0x00F2, 0x1ECF, 0x00F5, 0x1ECD},
+    {0x00F4, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9},
+    {0x01A1, 0x1EDB, 0x1EDD, 0x1EDF, 0x1EE1, 0x1EE3},
+    {0x0075, 0x00FA, 0x00F9, 0x1EE7, 0x0169, 0x1EE5},
+    {0x01B0, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1},
+    {0x0079, 0x00FD, 0x1EF3, 0x1EF7, 0x1EF9, 0x1EF5}
+};
+
+#define D_BAR 0x0111 // đ
+
+enum geAction {
+    ACT_TONE = 1, // Arg is the tone, 0 takes it away
+    ACT_HAT,      // Arg is the vowel a, e or o, VOWELS for any
+    ACT_HORN,     // Arg is HORN_UO and HORN_A
+    ACT_DD
+};
+
+#define HORN_UO 1 // u -> ư, o -> ơ
+#define HORN_A 2  // a -> ă
+
+#define KEY(act, arg) ((act) << 4 | (arg))
+
+static const unsigned char telexKeys[128] = {
+    ['s'] = KEY(ACT_TONE, 1), ['f'] = KEY(ACT_TONE, 2), ['r'] = KEY(ACT_TONE, 3),
+    ['x'] = KEY(ACT_TONE, 4), ['j'] = KEY(ACT_TONE, 5), ['z'] = KEY(ACT_TONE, 0),
+    ['a'] = KEY(ACT_HAT, V_A), ['e'] = KEY(ACT_HAT, V_E), ['o'] = KEY(ACT_HAT, V_O),
+    ['w'] = KEY(ACT_HORN, HORN_UO | HORN_A), ['d'] = KEY(ACT_DD, 0)
+};
+
+static const unsigned char vniKeys[128] = {
+    ['1'] = KEY(ACT_TONE, 1), ['2'] = KEY(ACT_TONE, 2), ['3'] = KEY(ACT_TONE, 3),
+    ['4'] = KEY(ACT_TONE, 4), ['5'] = KEY(ACT_TONE, 5), ['0'] = KEY(ACT_TONE, 0),
+    ['6'] = KEY(ACT_HAT, VOWELS), ['7'] = KEY(ACT_HORN, HORN_UO),
+    ['8'] = KEY(ACT_HORN, HORN_A), ['9'] = KEY(ACT_DD, 0)
+};
+
+/* Group of a vowel for hat keys: a, e or o */
+static const unsigned char hatGroup[VOWELS] = {
+    V_A, V_A, V_A, V_E, V_E, V_I, V_O, V_O, V_O, V_U, V_U, V_Y
+};
+
+typedef struct letter {
+    int vowel;     // enum geVowel, -1 for a consonant
+    int tone;
+    int upper;
+    unsigned base; // Lower case consonant
+} letter;
+
+/* Vowel * 6 + tone + 1 and 0x80 for upper case, of code points below
+ * 0x1B1 and from 0x1EA0 to 0x1EF9 */
+static unsigned char latinIndex[0x1B1];
+static unsigned char extIndex[0x5A];
+static int indexReady;
+
+static unsigned upperOf(unsigned cp) {
+    return cp < 0x100 ? cp - 0x20 : cp - 1;
+}
+
+static unsigned char *indexOf(unsigned cp) {
+    if(cp < 0x1B1) return &latinIndex[cp];
+    if(cp >= 0x1EA0 && cp < 0x1EFA) return &extIndex[cp - 0x1EA0];
+    return NULL;
+}
+
+static void buildIndex(void) {
+    for(int v = 0; v < VOWELS; v++) {
+        for(int t = 0; t < 6; t++) {
+            *indexOf(vowels[v][t]) = v * 6 + t + 1;
+            *indexOf(upperOf(vowels[v][t])) = (v * 6 + t + 1) | 0x80;
+        }
+    }
+    indexReady = 1;
+}
+
+/* Split cp in a letter, 0 when it is not a letter */
+static int readLetter(unsigned cp, letter *l) {
+    unsigned char *idx = indexOf(cp);
+    if(idx && *idx) {
+        l->vowel = ((*idx & 0x7F) - 1) / 6;
+        l->tone = ((*idx & 0x7F) - 1) % 6;
+        l->upper = *idx >> 7;
+        l->base = 0;
+        return 1;
+    }
+    l->vowel = -1;
+    l->tone = 0;
+    l->upper = (cp >= 'A' && cp <= 'Z') || cp == upperOf(D_BAR);
+    if(cp >= 'A' && cp <= 'Z') cp += 'a' - 'A';
+    if(cp == upperOf(D_BAR)) cp = D_BAR;
+    l->base = cp;
+    return (cp >= 'a' && cp <= 'z') || cp == D_BAR;
+}
+
+static unsigned writeLetter(const letter *l) {
+    unsigned cp = l->vowel >= 0 ? vowels[l->vowel][l->tone] : l->base;
+    return l->upper ? upperOf(cp) : cp;
+}
+
+/* Vowels of the word are from vstart to vend. 0 when it can not be
+ * a Vietnamese word */
+static int parse(const letter *w, int n, int *vstart, int *vend) {
+    int i = 0;
+    while(i < n && w[i].vowel < 0) i++;
+    if(i > 3) return 0;
+    // u of qu and i of gi before a vowel are part of the consonant
+    if(i < n - 1 && w[i + 1].vowel >= 0 &&
+       ((i == 1 && w[0].base == 'q' && w[i].vowel == V_U) ||
+        (i == 1 && w[0].base == 'g' && w[i].vowel == V_I)))
+        i++;
+    *vstart = i;
+    while(i < n && w[i].vowel >= 0) i++;
+    *vend = i;
+    if(*vend == *vstart || *vend - *vstart > 3) return 0;
+
+    // Final consonant: c ch m n ng nh p t
+    int left = n - i;
+    if(left == 0) return 1;
+    unsigned a = w[i].base, b = left > 1 ? w[i + 1].base : 0;
+    if(left > 2 || (left == 2 && w[i + 1].vowel >= 0)) return 0;
+    if(left == 1) return a == 'c' || a == 'm' || a == 'n' || a == 'p' || a == 't';
+    return (a == 'c' && b == 'h') || (a == 'n' && (b == 'g' || b == 'h'));
+}
+
+static int marked(int v) {
+    return v == V_AW || v == V_AA || v == V_EE || v == V_OO || v == V_OW || v == V_UW;
+}
+
+/* Vowel which takes the tone */
+static int tonePlace(const letter *w, int vstart, int vend, int n) {
+    for(int i = vend - 1; i >= vstart; i--) {
+        if(marked(w[i].vowel)) return i;
+    }
+    if(vend - vstart == 3) return vstart + 1;
+    if(vend - vstart == 2 && vend < n) return vstart + 1;
+    return vstart;
+}
+
+/* Tone of the vowels, 0 for none */
+static int toneOf(const letter *w, int vstart, int vend) {
+    for(int i = vstart; i < vend; i++) {
+        if(w[i].tone) return w[i].tone;
+    }
+    return 0;
+}
+
+static void setTone(letter *w, int vstart, int vend, int at, int tone) {
+    for(int i = vstart; i < vend; i++)
+        w[i].tone = i == at ? tone : 0;
+}
+
+/* Last vowel of group (a, e or o), VOWELS for any of them. -1 for none */
+static int findVowel(const letter *w, int vstart, int vend, int group) {
+    for(int i = vend - 1; i >= vstart; i--) {
+        int g = hatGroup[w[i].vowel];
+        if(group == VOWELS ? g == V_A || g == V_E || g == V_O : g == group)
+            return i;
+    }
+    return -1;
+}
+
+/* Action of key on word w, 1 when it did something. raw is set when
+ * the key undid a mark and is typed as it is */
+static int act(int action, letter *w, int n, int *raw) {
+    int kind = action >> 4, arg = action & 0xF;
+    int vstart, vend;
+    *raw = 0;
+
+    if(kind == ACT_DD) {
+        if(n == 0 || w[0].vowel >= 0 || (w[0].base != 'd' && w[0].base != D_BAR)) return 0;
+        *raw = w[0].base == D_BAR;
+        w[0].base = *raw ? 'd' : D_BAR;
+        return 1;
+    }
+    if(!parse(w, n, &vstart, &vend)) return 0;
+
+    if(kind == ACT_TONE) {
+        int at = tonePlace(w, vstart, vend, n);
+        int tone = toneOf(w, vstart, vend);
+        if(arg == 0 && tone == 0) return 0;
+        *raw = arg != 0 && w[at].tone == arg;
+        setTone(w, vstart, vend, at, *raw ? 0 : arg);
+        return 1;
+    }
+
+    if(kind == ACT_HAT) {
+        int i = findVowel(w, vstart, vend, arg);
+        if(i < 0) return 0;
+        int hat = hatGroup[w[i].vowel] == V_A ? V_AA : hatGroup[w[i].vowel] == V_E ? V_EE : V_OO;
+        *raw = w[i].vowel == hat;
+        w[i].vowel = *raw ? hatGroup[w[i].vowel] : hat;
+        return 1;
+    }
+
+    // Horn on uo goes on both of them
+    for(int i = vstart; i + 1 < vend && (arg & HORN_UO); i++) {
+        if(hatGroup[w[i].vowel] == V_U && hatGroup[w[i + 1].vowel] == V_O) {
+            *raw = w[i].vowel == V_UW && w[i + 1].vowel == V_OW;
+            w[i].vowel = *raw ? V_U : V_UW;
+            w[i + 1].vowel = *raw ? V_O : V_OW;
+            return 1;
+        }
+    }
+    for(int i = vend - 1; i >= vstart; i--) {
+        int g = hatGroup[w[i].vowel];
+        int horn = g == V_A ? V_AW : g == V_O ? V_OW : V_UW;
+        if(((arg & HORN_UO) && (g == V_U || g == V_O)) || ((arg & HORN_A) && g == V_A)) {
+            *raw = w[i].vowel == horn;
+            w[i].vowel = *raw ? g : horn;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+const char *geName(int method) {
+    static const char *names[GE_METHODS] = {"Off", "Telex", "VNI"};
+    return method > GE_OFF && method < GE_METHODS ? names[method] : names[GE_OFF];
+}
+
+int geKey(int method, const unsigned *text, int len, unsigned key, geEdit *e) {
+    e->count = 0;
+    e->append = 0;
+    if(method <= GE_OFF || method >= GE_METHODS || key >= 128) return 0;
+    if(!indexReady) buildIndex();
+
+    // Letters of the word before the cursor
+    letter w[GE_MAX_WORD + 1];
+    letter l;
+    int start = len;
+    while(start > 0 && len - start < GE_MAX_WORD && readLetter(text[start - 1], &l)) start--;
+    if(start > 0 && readLetter(text[start - 1], &l)) return 0; // Too long for a word
+    int n = len - start;
+    for(int i = 0; i < n; i++) readLetter(text[start + i], &w[i]);
+
+    unsigned k = key >= 'A' && key <= 'Z' ? key + ('a' - 'A') : key;
+    const unsigned char *keys = method == GE_TELEX ? telexKeys : vniKeys;
+    int raw = 0;
+    int m = n;
+    if(!keys[k] || !act(keys[k], w, n, &raw)) {
+        // Plain letter, it may move the tone
+        if(!readLetter(key, &w[n])) return 0;
+        m = n + 1;
+    }
+
+    int vstart, vend;
+    if(!raw && parse(w, m, &vstart, &vend)) {
+        int tone = toneOf(w, vstart, vend);
+        if(tone) setTone(w, vstart, vend, tonePlace(w, vstart, vend, m), tone);
+    }
+
+    for(int i = 0; i < n; i++) {
+        unsigned cp = writeLetter(&w[i]);
+        if(cp == text[start + i]) continue;
+        if(e->count == GE_MAX_CHANGES) return 0;
+        e->at[e->count] = start + i;
+        e->cp[e->count] = cp;
+        e->count++;
+    }
+    e->append = m > n ? writeLetter(&w[n]) : raw ? key : 0;
+    return e->count > 0 || e->append != key;
+}
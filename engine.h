@@ -0,0 +1,39 @@
+/* ============================================================
+   *File : engine.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Ghi Engine, typing Vietnamese with Telex or VNI.
+   A key looks at the word before the cursor and says which of its
+   characters change, nothing is allocated
+   ============================================================ */
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#define GE_MAX_WORD 16   // Characters before the cursor the engine looks at
+#define GE_MAX_CHANGES 4
+
+enum geMethod {
+    GE_OFF = 0,
+    GE_TELEX, // as -> á, aa -> â, aw -> ă, dd -> đ
+    GE_VNI,   // a1 -> á, a6 -> â, a8 -> ă, d9 -> đ
+    GE_METHODS
+};
+
+/* What a key does to the word: characters at[i] of the word become
+ * cp[i], then append is typed after it when it is not 0 */
+typedef struct geEdit geEdit;
+struct geEdit {
+    int count;
+    int at[GE_MAX_CHANGES];
+    unsigned cp[GE_MAX_CHANGES];
+    unsigned append;
+};
+
+/* Name of a method for the status bar */
+const char *geName(int method);
+
+/* Key typed after the len characters of text. Return 0 when the key
+ * is typed as it is, otherwise 1 and what to do in e */
+int geKey(int method, const unsigned *text, int len, unsigned key, geEdit *e);
+
+#endif // End ENGINE_H
@@ -26,27 +26,68 @@
 #include <ctype.h>
 #include <errno.h>
 #include <fcntl.h> // maniplate file descriptor
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h> // Hang up is seen by poll, not the signal
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h> // strcasecmp
 #include <sys/ioctl.h> // Winsize
+#include <sys/mman.h> // Map file into memory
+#include <sys/resource.h> // Peak memory of a headless run
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h> // writev
 #include <termios.h> //Enable rawmode
 #include <time.h>
 #include <unistd.h>
 
+#include "engine.h"
+#include "grapheme.h"
+#include "journal.h"
+#include "latency.h"
+#include "linetree.h"
+#include "markdown.h"
+#include "mem.h"
+#include "search.h"
+#include "trigram.h"
+#include "undo.h"
 #include "unicode.h"
+#include "utf8.h"
 
 /*** defines ***/
 #define GHI_VERSION "0.0.1"
 #define GHI_TAB_STOP 8
 #define GHI_QUIT_TIMES 3 // Warn user to force quit
+#define GHI_FIND_THREADS_ROWS 50000 // Search on worker threads from this many rows
+#define GHI_INDEX_BATCH 4096 // Rows indexed each time the index thread holds the lock
+#define GHI_JOURNAL_SYNC_MS 200 // Journal reaches the disk this often
+#define GHI_SAVE_IOV 1023 // Buffers given to one writev, three per row
+#define GHI_INPUT_SIZE 4096 // Bytes of keys read at once
+#define GHI_ESC_WAIT_MS 100 // Wait for the rest of an escape sequence
+#define GHI_PASTE_WAIT_MS 1000 // Paste without its end mark stops after this
+#define GHI_UNDO_BYTES (4 << 20) // Memory of the undo log, GHI_UNDO_BYTES=n to change
+#define GHI_INDEX_MAX_PART 8 // Index is not used when it gives more than 1/8 of rows
+#define GHI_SAVE_NORM_BYTES (1 << 20) // Normalized rows kept for one writev
+#define GHI_HEADLESS_ROWS 24 // Screen of a headless run, GHI_SIZE=rowsxcols to change
+#define GHI_HEADLESS_COLS 80
+#define GHI_LARGE_MB 512 // Files from this size open in large mode, GHI_LARGE_MB=n to change
+#define GHI_SPAN_LINES 1024 // Large mode keeps up to this many lines as one item
+#define GHI_SPAN_BYTES (1 << 20)
+#define GHI_LARGE_WINDOW 512 // Rows kept above and below the screen in large mode
+#define GHI_LARGE_ROWS 2048 // Rows split out of spans before far ones are put back
+#define GHI_LARGE_DROP (8 << 20) // Pages of the map read in a row are given back this often
+#define GHI_LOAD_BATCH 16384 // Lines the loader thread adds each time it holds the lock
+#define GHI_LOAD_DRAW_MS 100 // Screen is drawn this often while a file loads
+#define GHI_HL_SPANS 256 // Highlight spans of a row, the rest of it is drawn plain
 #define CTRL_KEY(k) ((k) & 0x1f) //00011111 , 3 bit is ctrl and 5 bit is character ascii
 
 enum editorKey {
     BACKSPACE = 127,
-    ARROW_LEFT  = 1000,
+    ARROW_LEFT  = 0x110000, // After the last code point, typed characters come before
     ARROW_RIGHT,
     ARROW_UP   ,
     ARROW_DOWN ,
@@ -54,21 +95,69 @@ enum editorKey {
     HOME_KEY,
     END_KEY,
     PAGE_UP,
-    PAGE_DOWN
+    PAGE_DOWN,
+    PASTE_START,
+    PASTE_END
 };
 
 /*** data ***/
 // Store a row of text in editor
 // Editor row
 typedef struct erow {
-    int size;
-    int rsize; // render size
-    char *chars;
-    char *render;
-    alchars alc; // Chars for store unicode character
-    alchars renderAlc;
+    int size; // Number of characters
+    alchars alc; // Utf-8 text of the row, the only copy of it
+    const char *src; // Line in the mapped file, used until the row is loaded
+    int srclen;
+    unsigned id; // Never changes while the row lives, used by the index
+    struct rowCols *cols; // Clusters and their columns, NULL until needed
+    int edited; // Text differs from src, the row can not go back to the file
+    unsigned short hlIn; // Markdown state at the start of the row, 0 until known
+    unsigned short hlOut; // State at its end, after the last line of a span
 } erow;
 
+/* Grapheme clusters of a row with tabs, wide or combining characters.
+ * Cluster i starts at character at[i] and screen column col[i], entry
+ * count is the end of the row */
+typedef struct rowCols {
+    int count;
+    int cap; // Entries of at and col
+    int tabs; // Row has had a tab, columns after it depend on the ones before
+    int *at;
+    int *col;
+} rowCols;
+
+rowCols plainCols; // Cache of rows where each character is one column
+
+/* Highlight of the row being drawn, its spans are passed in order */
+typedef struct rowHl {
+    const mdSpan *spans;
+    int count;
+    int next; // First span not ending before the bytes drawn
+    int hl; // Highlight the frame line is in now
+} rowHl;
+
+// Escape of each markdown highlight, it resets the one before
+const char *hlColors[MD_HIGHLIGHTS] = {
+    [MD_NORMAL] = "\x1b[m",
+    [MD_HEADING] = "\x1b[0;1;36m",
+    [MD_EMPHASIS] = "\x1b[0;3m",
+    [MD_STRONG] = "\x1b[0;1m",
+    [MD_CODE] = "\x1b[0;32m",
+    [MD_FENCE] = "\x1b[0;2;32m",
+    [MD_LINK] = "\x1b[0;4;34m",
+    [MD_URL] = "\x1b[0;34m",
+    [MD_MARKER] = "\x1b[0;33m"
+};
+
+/* Replace write out byte by append buffer */
+struct abuf {
+    char *b;
+    int len;
+    int cap;
+};
+
+#define ABUF_INIT {NULL,0,0} // Represent constructor for append bufffer
+
 struct editorConfig {
     int cx,cy; // x,y
     int rx; // Fix move over tabs when tab is spaces
@@ -77,42 +166,107 @@ struct editorConfig {
     int screenrows;
     int screencols;
     int numrows; // number of rows display
-    erow *row; // Support multiple line
+    linetree *rows; // Support multiple line, reach a row by editorRow()
+    mpool *pool; // Text and rows of the buffer are allocated here
     int dirty; // State modified a file
     char *filename;
+    char *map; // Opened file mapped into memory
+    size_t mapsize;
+    size_t largeBytes; // Files from this size open in large mode, 0 for never
+    int large; // Lines stay in spans of the map, rows near the screen are split out
+    int largeRows; // Rows split out of spans since the last sweep
+    int largeSweep; // Sweep before the next key, a search read the whole map
+    int loading; // Loader thread is adding rows of the map
+    int loader; // Loader thread was started and not joined yet
+    int loadStop;
+    const char *loadPos; // Start of the next line to load
+    const char *loadDrop; // Large mode: pages before it were given back
+    pthread_t loadThread;
+    int hlMode; // Markdown highlight on or off (GHI_MARKDOWN=1|0), -1 by file name
+    int hlClean; // Rows before it which know their markdown state have it right
     char statusmsg[80];
     time_t statusmsg_time;
     struct termios orig_terminos;    // Terminal attribute
+    struct abuf *frame; // Lines of the frame being drawn
+    struct abuf *shadow; // Lines of the last frame on the terminal
+    int framerows; // Number of lines in frame and shadow
+    int shadowValid; // Terminal shows what shadow has
+    int frameBytes; // Bytes written by the last refresh
+    long long totalBytes; // Bytes written by all refreshes
+    struct abuf out; // Bytes of a refresh, reused
+    int stats; // Show output counters in status bar (GHI_STATS=1)
+    unsigned nextId; // Id of the next new row
+    trigramIndex *index; // Trigrams of rows, NULL when off (GHI_INDEX=1)
+    erow **idRows; // Row of each id in the index, NULL when deleted
+    unsigned idCap;
+    int indexNext; // Next row the index thread adds
+    int indexReady; // Every row is in the index
+    int indexStop;
+    pthread_t indexThread;
+    pthread_mutex_t lock; // Held by the main thread except while waiting for a key
+    pthread_mutex_t gate; // Taken before lock, so a waiting thread gets its turn
+    journal *journal; // Edits since last save, opened on first edit
+    int journalOn; // Edits are recorded, off while opening and replaying
+    undoLog *undo; // Steps for Ctrl-Z and Ctrl-Y, NULL until the file is open
+    int method; // Vietnamese typing, enum geMethod (Ctrl-T, GHI_INPUT=telex|vni)
+    int normOpen; // Form rows are put in when loaded, enum normForm (GHI_NORM_OPEN=nfc|nfd)
+    int normSave; // Form of saved text (GHI_NORM_SAVE), normOpen when not set
+    int headless; // Keys come from a file or pipe, not a terminal (bench)
+    int inputEnd; // Headless run read all of its keys
+    latRecorder *latency; // Key to frame times, NULL when off (GHI_LATENCY=file)
+    char *latencyPath; // Histograms are written here on exit
+    long long inputTime; // When the bytes in input came
+    long long keyTime; // When the key being handled came
+    long keys; // Keys handled in a headless run
+    struct timespec runStart; // Headless run: start, then after the file is open
+    long long openNs;
+    memStats openStats;
+    long openRss;
+    char input[GHI_INPUT_SIZE]; // Keys read from the terminal, not handled yet
+    int inputLen;
+    int inputPos;
 };
 
 struct editorConfig E; // Make global variable for config
 
-/*** Append buffer ***/
-/* Replace write out byte by append buffer */
-struct abuf {
-    char *b;
-    int len;
+/* Edits recorded in the journal */
+enum editorJournalOp {
+    JOURNAL_INSERT_CHAR = 1, // row, col, value is the code point
+    JOURNAL_DEL_CHAR,        // row, col
+    JOURNAL_INSERT_ROW,      // row, bytes
+    JOURNAL_DEL_ROW,         // row
+    JOURNAL_APPEND,          // row, bytes
+    JOURNAL_TRUNCATE,        // row, col
+    JOURNAL_INSERT_TEXT      // row, col, bytes
 };
 
-#define ABUF_INIT {NULL,0} // Represent constructor for append bufffer
+/*** Append buffer ***/
 
 /* Append string s into struct abuf with len */
 void abAppend(struct abuf *ab, const char *s, int len) {
     // extend location for store string append
     // When relloc address memory in ab will destroy
     // and create new address
-    char *new = realloc(ab->b, ab->len + len);
-    if(new == NULL) return;
+    // Capacity is doubled so a reused buffer stops growing
+    if(len <= 0) return;
+    if(ab->len + len > ab->cap) {
+        int cap = ab->cap ? ab->cap * 2 : 64;
+        while(cap < ab->len + len) cap *= 2;
+        char *new = poolRealloc(NULL, ab->b, ab->cap, cap);
+        if(new == NULL) return;
+        ab->b = new; // Add new memory
+        ab->cap = cap;
+    }
 
-    memcpy(&new[ab->len],s,len);// Put string into loction mem
-    // Referent new point append
-    ab->b = new; // Add new memory
+    memcpy(&ab->b[ab->len],s,len);// Put string into loction mem
     ab->len += len;
 }
 
 /* Free string */
 void abFree(struct abuf *ab) {
-    free(ab->b);
+    poolFree(NULL, ab->b, ab->cap);
+    ab->b = NULL;
+    ab->len = ab->cap = 0;
 }
 
 /*** prototypes ***/
@@ -120,6 +274,17 @@ void editorSetStatusMessage(const char *fmt, ...);
 void editorRefreshScreen();
 char *editorPrompt(char *prompt, void (*callback)(char *, int));
 void convertToUnicode(struct abuf *ab, unsigned codePoint);
+void editorHeadlessEnd();
+void editorInputEnd();
+void editorIndexStart();
+int editorIndexWanted();
+void editorLoadEnd(int stop);
+void editorIndexRow(erow *row);
+void editorIndexRange(erow *row, int from, int to);
+void editorIndexForget(erow *row);
+void editorIndexStop();
+void editorJournal(int op, int row, int col, long value, const char *bytes, int len);
+void editorUndoAdd(int op, int row, int col, int count, const char *bytes, int len);
 
 /*** terminal ***/
 /* Error handling */
@@ -133,6 +298,7 @@ void die(const char *s) {
 
 /* Restart configuration terminal */
 void disableRawMode() {
+    write(STDOUT_FILENO,"\x1b[?2004l",8); // Bracketed paste off
     if (tcsetattr(STDIN_FILENO,TCSAFLUSH,&E.orig_terminos) == 1) {
         die("tcsetattr");
     } // This function will restore
@@ -147,6 +313,8 @@ void disableRawMode() {
  * - all outpt processing like "\n" and "\r\n"
  */
 void enableRawMode() {
+    // Headless run, keys come from a script
+    if(E.headless) return;
 
     if(tcgetattr(STDIN_FILENO, &E.orig_terminos) == -1) {
         die("tcgetattr");
@@ -172,27 +340,97 @@ void enableRawMode() {
         die("tcsetattr");
     }// Set attribute of terminal
 
+    // Pasted text comes between <esc>[200~ and <esc>[201~
+    write(STDOUT_FILENO,"\x1b[?2004h",8);
+
+}
+
+/* Take the editor lock. Going through gate first means a thread which
+ * just gave the lock up waits behind us instead of taking it back */
+void editorLock() {
+    pthread_mutex_lock(&E.gate);
+    pthread_mutex_lock(&E.lock);
+    pthread_mutex_unlock(&E.gate);
+}
+
+void editorUnlock() {
+    pthread_mutex_unlock(&E.lock);
+}
+
+/* Read all bytes the terminal has into the input buffer, waiting at
+ * most ms milliseconds for them (-1 for ever). Return 0 when none came */
+int editorFillInput(int ms) {
+    if(E.inputPos < E.inputLen) return 1;
+    E.inputPos = E.inputLen = 0;
+
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    int ready;
+    while((ready = poll(&pfd, 1, ms)) == -1) {
+        if(errno != EINTR) die("poll");
+    }
+    if(ready == 0) return 0;
+    // Terminal hung up (closed or ssh dropped), no key comes any more
+    if((pfd.revents & (POLLHUP | POLLERR | POLLNVAL)) && !(pfd.revents & POLLIN)) {
+        E.inputEnd = 1;
+        return 0;
+    }
+
+    ssize_t nread = read(STDIN_FILENO, E.input, GHI_INPUT_SIZE);
+    if(nread == 0 || (nread == -1 && errno == EIO)) E.inputEnd = 1;
+    else if(nread == -1 && errno != EAGAIN && errno != EINTR) die("read");
+    if(nread <= 0) return 0;
+    E.inputLen = nread;
+    if(E.latency) E.inputTime = latNow();
+    return 1;
+}
+
+/* Next byte of an escape sequence, 0 when it does not come in time */
+int editorInputByte(char *c) {
+    if(!editorFillInput(GHI_ESC_WAIT_MS)) return 0;
+    *c = E.input[E.inputPos++];
+    return 1;
+}
+
+/* A key is waiting to be read. Keys of a headless run are taken one
+ * by one like typed keys, each one is drawn */
+int editorKeyPending() {
+    if(E.headless) return 0;
+    if(E.inputPos < E.inputLen) return 1;
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    return poll(&pfd, 1, 0) > 0;
 }
 
 int editorReadKey() {
-    int nread;
-    char c;
-    while((nread = read(STDIN_FILENO, &c, 1)) != 1) {
-        if(nread == -1 && errno != EAGAIN) die("read");
+    if(E.inputPos == E.inputLen) {
+        // Other threads may use the rows while we wait. While a file
+        // loads the screen is drawn now and then to show its rows
+        int loading = E.loading;
+        editorUnlock();
+        while(!editorFillInput(loading ? GHI_LOAD_DRAW_MS : -1) && !E.inputEnd) {
+            if(!loading) continue;
+            editorLock();
+            loading = E.loading;
+            editorRefreshScreen();
+            editorUnlock();
+        }
+        editorLock();
+        if(E.inputEnd) editorInputEnd();
     }
+    E.keyTime = E.inputTime;
+    char c = E.input[E.inputPos++];
 
     // Arrow key like \x1bA ,\x1bB,\x1bC,\x1bD
     if(c =='\x1b') {
         char seq[3];
 
-        if (read(STDIN_FILENO, &seq[0],1) != 1) return '\x1b';
-        if (read(STDIN_FILENO, &seq[1],1) != 1) return '\x1b';
+        if(!editorInputByte(&seq[0])) return '\x1b';
+        if(!editorInputByte(&seq[1])) return '\x1b';
         if(seq[0] == '[') {
             // Configuration for page up and page down key
             // page up key has value <esc>[5~
             // page down key has value <esc>[6~
             if(seq[1] >= '0' && seq[1] <= '9') {
-                if(read(STDIN_FILENO,&seq[2],1) != 1) return '\x1b';
+                if(!editorInputByte(&seq[2])) return '\x1b';
                 if(seq[2] == '~') {
                     switch (seq[1]) {
                         case '1': return HOME_KEY;
@@ -201,6 +439,13 @@ int editorReadKey() {
                         case '5': return PAGE_UP;
                         case '6': return PAGE_DOWN;
                     }
+                } else if(seq[1] == '2' && seq[2] == '0') {
+                    // Paste marks <esc>[200~ and <esc>[201~
+                    char mark[2];
+                    if(!editorInputByte(&mark[0])) return '\x1b';
+                    if(!editorInputByte(&mark[1])) return '\x1b';
+                    if(mark[0] == '0' && mark[1] == '~') return PASTE_START;
+                    if(mark[0] == '1' && mark[1] == '~') return PASTE_END;
                 }
             } else {
                 switch (seq[1]) {
@@ -221,6 +466,23 @@ int editorReadKey() {
         }
 
         return '\x1b';
+    } else if((unsigned char)c >= 0x80) {
+        // Bytes of a typed utf-8 character come together
+        // Same rules as the gap buffer: no overlong forms, surrogates or
+        // values past 0x10FFFF, those would be read as the keys above it
+        static const int least[] = {0x80, 0x800, 0x10000};
+        unsigned char lead = c;
+        int n = lead >= 0xF5 ? -1 : lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC2 ? 1 : -1;
+        if(n < 0) return '\x1b';
+        int len = n;
+        int cp = lead & (0x3F >> n);
+        while(n--) {
+            if(!editorInputByte(&c) || (c & 0xC0) != 0x80) return '\x1b';
+            cp = (cp << 6) | (c & 0x3F);
+        }
+        if(cp < least[len - 1] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+            return '\x1b';
+        return cp;
     } else {
         return c;
     }
@@ -249,6 +511,15 @@ int getCursorPosition(int *rows, int *cols) {
 int getWindowSize(int *rows, int *cols) {
     struct winsize ws;
 
+    if(E.headless) {
+        char *size = getenv("GHI_SIZE");
+        if(size == NULL || sscanf(size, "%dx%d", rows, cols) != 2 || *rows < 3 || *cols < 1) {
+            *rows = GHI_HEADLESS_ROWS;
+            *cols = GHI_HEADLESS_COLS;
+        }
+        return 0;
+    }
+
     if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == -1 || ws.ws_col == 0) {
         if(write(STDOUT_FILENO,"\x1b[999C\x1b[999B",12) != 12) return -1;
         // Some time ioctl is not working on some OS
@@ -264,138 +535,565 @@ int getWindowSize(int *rows, int *cols) {
 
 /*** row operations  ***/
 
-int editorRowCxToRx(erow *row, int cx) {
-    int rx = 0;
-    int j;
-    for(j = 0; j < cx; j++) {
-        if(row->chars[j] == '\t')
-            rx += (GHI_TAB_STOP - 1) - (rx % GHI_TAB_STOP);
-        rx++;
-    }
-    return rx;
+/* Code point of utf-8 text at pos, pos moves past it */
+unsigned editorNextChar(const char *s, int len, int *pos) {
+    unsigned char c = s[*pos];
+    int n = c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    unsigned cp = n == 1 ? c : c & (0x3F >> (n - 1));
+    if(*pos + n > len) n = 1;
+    for(int i = 1; i < n; i++)
+        cp = (cp << 6) | (s[*pos + i] & 0x3F);
+    *pos += n;
+    return cp;
 }
 
-int editorRowRxToCx(erow *row, int rx) {
-    int cur_rx = 0;
-    int cx;
-    for(cx = 0; cx < row->size; cx++) {
-        if(row->chars[cx] == '\t')
-            cur_rx += (GHI_TAB_STOP - 1) - (cur_rx % GHI_TAB_STOP);
-        cur_rx++;
+/* Clusters of a row, built from the text when first asked for after
+ * the row changed. Rows where each character is one column share
+ * plainCols and keep nothing */
+rowCols *editorRowCols(erow *row) {
+    if(row->cols) return row->cols;
+    const char *seg[2];
+    int seglen[2];
+    int i;
+    getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+
+    int cap = row->size + 1;
+    rowCols *c = poolAlloc(E.pool, sizeof(rowCols) + 2 * cap * sizeof(int));
+    if(c == NULL) return &plainCols;
+    c->cap = cap;
+    c->at = (int *)(c + 1);
+    c->col = c->at + cap;
+
+    grState st;
+    grInit(&st);
+    int n = 0, cx = 0, col = 0;
+    int plain = 1;
+    c->tabs = 0;
+    for(i = 0; i < 2; i++) {
+        int pos = 0;
+        while(pos < seglen[i] && cx < row->size) {
+            unsigned cp = editorNextChar(seg[i], seglen[i], &pos);
+            int w = cp == '\t' ? GHI_TAB_STOP - col % GHI_TAB_STOP : grWidth(cp);
+            if(grBreak(&st, cp)) {
+                c->at[n] = cx;
+                c->col[n] = col;
+                n++;
+            } else {
+                plain = 0;
+            }
+            if(w != 1 || cp == '\t') plain = 0;
+            if(cp == '\t') c->tabs = 1;
+            col += w;
+            cx++;
+        }
+    }
+    c->count = n;
+    c->at[n] = cx;
+    c->col[n] = col;
 
-        if(cur_rx > rx) return cx;
+    if(plain) {
+        poolFree(E.pool, c, sizeof(rowCols) + 2 * cap * sizeof(int));
+        c = &plainCols;
     }
+    row->cols = c;
+    return c;
+}
 
-    return cx;
+void editorRowDropCols(erow *row) {
+    rowCols *c = row->cols;
+    row->cols = NULL;
+    if(c == NULL || c == &plainCols) return;
+    poolFree(E.pool, c, sizeof(rowCols) + 2 * c->cap * sizeof(int));
+}
+
+/* Last cluster starting at or before character cx */
+int editorColsFind(rowCols *c, int cx) {
+    int lo = 0, hi = c->count;
+    while(lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if(c->at[mid] <= cx) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
 }
 
-void editorUpdateRow(erow *row) {
-    int tabs = 0;
-    int j;
+/* Grapheme state after a code point of class cls does not depend on
+ * the text before it */
+int editorGrFresh(int cls) {
+    return cls != GR_REGIONAL && cls != GR_ZWJ && cls != GR_EXTEND;
+}
 
-    // Count tabs character
-    for(j = 0; j < row->size;j++) {
-        if(row->chars[j] == '\t') tabs++;
+/* Clusters of a row after the edit of editorRowColsEdited. They are
+ * looked at again from the one before at until one of them starts
+ * where an old one did, with the same state and a column a tab stop
+ * does not change. The old ones from there are moved, not looked at.
+ * Return 0 when there is no memory */
+int editorRowColsUpdate(erow *row, int at, int n) {
+    static int *buf = NULL; // New clusters, at and col of each one
+    static int cap = 0;
+    rowCols *c = row->cols;
+    int delta = row->size - c->at[c->count];
+
+    // Clusters up to the one holding at - 1 stay, state before the
+    // first one looked at must be known without the text before it
+    int k = editorColsFind(c, at > 0 ? at - 1 : 0);
+    int cls = -1;
+    for(; k > 0; k--) {
+        achar *ch = getBucketAt(row->alc, c->at[k] - 1);
+        int pos = 0;
+        cls = grClassOf(editorNextChar(ch->bytes, ch->length, &pos));
+        if(editorGrFresh(cls)) break;
+    }
+    grState st;
+    grInit(&st);
+    if(k > 0) {
+        st.prev = cls;
+        st.picto = cls == GR_PICTO;
     }
 
-    free(row->render);
-    // 7 tabs because we have one tabs from default
-    row->render = malloc(row->size +tabs*(GHI_TAB_STOP - 1) + 1);
+    const char *seg[2];
+    int seglen[2];
+    getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+    int cx = c->at[k], col = c->col[k];
+    int pos = getByteOffset(row->alc, cx);
+    int i = 0;
+    if(pos >= seglen[0]) {
+        pos -= seglen[0];
+        i = 1;
+    }
+    int m = 0, from = -1;
+    for(; i < 2 && from < 0; i++, pos = 0) {
+        while(pos < seglen[i] && cx < row->size) {
+            unsigned cp = editorNextChar(seg[i], seglen[i], &pos);
+            int prev = st.prev;
+            if(grBreak(&st, cp)) {
+                if(cx > at + n && editorGrFresh(prev)) {
+                    int old = editorColsFind(c, cx - delta);
+                    if(c->at[old] == cx - delta &&
+                       (!c->tabs || (col - c->col[old]) % GHI_TAB_STOP == 0)) {
+                        from = old;
+                        break;
+                    }
+                }
+                if(2 * (m + 1) > cap) {
+                    int grown = cap ? cap * 2 : 64;
+                    int *more = realloc(buf, grown * sizeof(int));
+                    if(more == NULL) return 0;
+                    buf = more;
+                    cap = grown;
+                }
+                buf[2 * m] = cx;
+                buf[2 * m + 1] = col;
+                m++;
+            }
+            if(cp == '\t') c->tabs = 1;
+            col += cp == '\t' ? GHI_TAB_STOP - col % GHI_TAB_STOP : grWidth(cp);
+            cx++;
+        }
+    }
 
-    int idx = 0;
-    for(j = 0; j < row->size;j++) {
-        // Replace tab character with spaces
-        if(row->chars[j] == '\t') {
-            row->render[idx++]=' ';
-            while(idx % GHI_TAB_STOP != 0) row->render[idx++] = ' ';
-        } else {
-            // Check printable character
-            row->render[idx++] = row->chars[j];
+    // Old clusters from from on and the end entry move by the change
+    int tail = from < 0 ? 0 : c->count - from;
+    int count = k + m + tail;
+    if(count + 1 > c->cap) {
+        int grown = count + 1 + count / 2;
+        rowCols *g = poolAlloc(E.pool, sizeof(rowCols) + 2 * grown * sizeof(int));
+        if(g == NULL) return 0;
+        g->cap = grown;
+        g->tabs = c->tabs;
+        g->at = (int *)(g + 1);
+        g->col = g->at + grown;
+        memcpy(g->at, c->at, k * sizeof(int));
+        memcpy(g->col, c->col, k * sizeof(int));
+        if(from >= 0) {
+            memcpy(&g->at[k + m], &c->at[from], (tail + 1) * sizeof(int));
+            memcpy(&g->col[k + m], &c->col[from], (tail + 1) * sizeof(int));
         }
+        editorRowDropCols(row);
+        row->cols = c = g;
+    } else if(from >= 0) {
+        memmove(&c->at[k + m], &c->at[from], (tail + 1) * sizeof(int));
+        memmove(&c->col[k + m], &c->col[from], (tail + 1) * sizeof(int));
+    }
+    if(from >= 0) {
+        int shift = col - c->col[k + m];
+        for(int j = k + m; j <= count; j++) {
+            c->at[j] += delta;
+            c->col[j] += shift;
+        }
+    } else {
+        c->at[count] = cx;
+        c->col[count] = col;
+    }
+    for(int j = 0; j < m; j++) {
+        c->at[k + j] = buf[2 * j];
+        c->col[k + j] = buf[2 * j + 1];
     }
-    row->render[idx] = '\0';
-    row->rsize = idx;
+    c->count = count;
+    return 1;
 }
 
-void editorUpdateUnicodeRow(erow *row) {
-    int tabs = 0;
-    int j;
-    for(j = 0; j < row->size;j++) {
-        achar *ac = getBucketAt(row->alc,j);
-        if(ac->length == 1 && ac->bytes[0] == '\t') {
-            tabs++;
-        }
+/* Plain row stays plain when each character from the one before at
+ * up to where the old text is seen again is one column and a cluster */
+int editorRowStaysPlain(erow *row, int at, int n) {
+    int s = at > 0 ? at - 1 : 0;
+    int cls = -1, pos;
+    for(; s > 0; s--) {
+        achar *ch = getBucketAt(row->alc, s - 1);
+        pos = 0;
+        cls = grClassOf(editorNextChar(ch->bytes, ch->length, &pos));
+        if(editorGrFresh(cls)) break;
     }
-    // Free old render to render new string
-    
-    freeChars(row->renderAlc);
-    row->renderAlc = newChar();
-
-    int idx = 0;
-    for(j = 0; j < row->size; j++) {
-        achar *ac = getBucketAt(row->alc,j);
-        if(ac == NULL) {
-            fprintf(stderr,"Error at %d",j);
+    grState st;
+    grInit(&st);
+    if(s > 0) {
+        st.prev = cls;
+        st.picto = cls == GR_PICTO;
+    }
+    for(; s < row->size; s++) {
+        achar *ch = getBucketAt(row->alc, s);
+        pos = 0;
+        unsigned cp = editorNextChar(ch->bytes, ch->length, &pos);
+        int prev = st.prev;
+        int brk = grBreak(&st, cp);
+        if(brk && s > at + n && editorGrFresh(prev)) return 1;
+        if(!brk || cp == '\t' || grWidth(cp) != 1) return 0;
+    }
+    return 1;
+}
+
+/* Row changed at character at, n characters are new there. A plain
+ * row stays plain while the text around the change is one column a
+ * character, other rows have their clusters updated from the change */
+void editorRowColsEdited(erow *row, int at, int n) {
+    row->edited = 1;
+    // Highlight state of the row and the ones after it is looked at again
+    row->hlIn = 0;
+    int rowAt = ltIndexOf(E.rows, row);
+    if(rowAt < E.hlClean) E.hlClean = rowAt;
+    if(row->cols == &plainCols) {
+        int i;
+        for(i = at - 1; i <= at + n; i++) {
+            achar *ch = getBucketAt(row->alc, i);
+            if(ch && ((unsigned char)ch->bytes[0] >= 0x80 || ch->bytes[0] == '\t'))
+                break;
         }
-        // Replace tab character with spaces
-        if(ac->length == 1 && ac->bytes[0] == '\t') {
-            appendNewChar(row->renderAlc,' ');
-            idx++;
-            while(idx % GHI_TAB_STOP != 0) {
-                appendNewChar(row->renderAlc,' ');
-                idx++;
-            }
+        if(i > at + n || editorRowStaysPlain(row, at, n)) return;
+    } else if(row->cols && editorRowColsUpdate(row, at, n)) {
+        return;
+    }
+    editorRowDropCols(row);
+}
+
+/* Screen column of character cx, the one of its cluster start */
+int editorRowCxToRx(erow *row, int cx) {
+    rowCols *c = editorRowCols(row);
+    if(c == &plainCols) return cx;
+    return c->col[editorColsFind(c, cx)];
+}
+
+/* Character of the cluster on screen column rx */
+int editorRowRxToCx(erow *row, int rx) {
+    rowCols *c = editorRowCols(row);
+    if(c == &plainCols) return rx < row->size ? rx : row->size;
+    int lo = 0, hi = c->count;
+    while(lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if(c->col[mid] <= rx) lo = mid;
+        else hi = mid - 1;
+    }
+    return c->at[lo];
+}
+
+/* Start of the cluster holding character cx */
+int editorRowClusterStart(erow *row, int cx) {
+    rowCols *c = editorRowCols(row);
+    if(c == &plainCols) return cx;
+    return c->at[editorColsFind(c, cx)];
+}
+
+/* Start of the cluster before (dir -1) or after (dir 1) the one at cx */
+int editorRowMoveCluster(erow *row, int cx, int dir) {
+    rowCols *c = editorRowCols(row);
+    if(c == &plainCols) {
+        cx += dir;
+        return cx < 0 ? 0 : cx > row->size ? row->size : cx;
+    }
+    int k = editorColsFind(c, cx);
+    if(dir < 0 && k > 0 && c->at[k] == cx) k--;
+    else if(dir > 0 && k < c->count) k++;
+    return c->at[k];
+}
+
+/* Append bytes from, to of text in two parts */
+void editorAppendSegments(struct abuf *ab, const char **seg, int *seglen, int from, int to) {
+    if(from < seglen[0])
+        abAppend(ab, &seg[0][from], (to < seglen[0] ? to : seglen[0]) - from);
+    if(to > seglen[0]) {
+        int start = from > seglen[0] ? from - seglen[0] : 0;
+        abAppend(ab, &seg[1][start], to - seglen[0] - start);
+    }
+}
+
+/* Highlight of byte at and the byte where it changes, at only grows */
+int editorHlAt(rowHl *h, int at, int *until) {
+    while(h->next < h->count && h->spans[h->next].end <= at) h->next++;
+    if(h->next == h->count) {
+        *until = INT_MAX;
+        return MD_NORMAL;
+    }
+    const mdSpan *span = &h->spans[h->next];
+    if(at < span->start) {
+        *until = span->start;
+        return MD_NORMAL;
+    }
+    *until = span->end;
+    return span->hl;
+}
+
+void editorHlSwitch(struct abuf *ab, rowHl *h, int hl) {
+    if(hl == h->hl) return;
+    abAppend(ab, hlColors[hl], strlen(hlColors[hl]));
+    h->hl = hl;
+}
+
+/* Append bytes from, to like editorAppendSegments, switching colors
+ * where the highlight changes. Plain text without h */
+void editorAppendHl(struct abuf *ab, const char **seg, int *seglen, int from, int to, rowHl *h) {
+    if(h == NULL) {
+        editorAppendSegments(ab, seg, seglen, from, to);
+        return;
+    }
+    while(from < to) {
+        int until;
+        editorHlSwitch(ab, h, editorHlAt(h, from, &until));
+        if(until > to) until = to;
+        editorAppendSegments(ab, seg, seglen, from, until);
+        from = until;
+    }
+}
+
+/* Append the columns of a row which are on screen to ab. Tabs are
+ * expanded here, a wide character cut by a screen edge shows as
+ * blanks. With h the text is colored by its highlight */
+void editorDrawRowText(struct abuf *ab, erow *row, rowHl *h) {
+    const char *seg[2];
+    int seglen[2];
+    int left = E.coloff;
+    int right = E.coloff + E.screencols;
+    rowCols *c = editorRowCols(row);
+    getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+
+    if(c == &plainCols) {
+        // A column is a character, copy the bytes between at once
+        int from = getByteOffset(row->alc, left < row->size ? left : row->size);
+        int to = getByteOffset(row->alc, right < row->size ? right : row->size);
+        editorAppendHl(ab, seg, seglen, from, to, h);
+        return;
+    }
+
+    int lo = 0, hi = c->count;
+    while(lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if(c->col[mid] <= left) lo = mid;
+        else hi = mid - 1;
+    }
+    int k = lo;
+    int to = getByteOffset(row->alc, c->at[k]);
+    for(; k < c->count && c->col[k] < right; k++) {
+        int from = to;
+        to = getByteOffset(row->alc, c->at[k + 1]);
+        int first = from < seglen[0] ? seg[0][from] : seg[1][from - seglen[0]];
+        if(first == '\t' || c->col[k] < left || c->col[k + 1] > right) {
+            int until;
+            if(h) editorHlSwitch(ab, h, editorHlAt(h, from, &until));
+            int col = c->col[k] > left ? c->col[k] : left;
+            int end = c->col[k + 1] < right ? c->col[k + 1] : right;
+            for(; col < end; col++) abAppend(ab, " ", 1);
         } else {
-            appendNewStringWithLen(row->renderAlc,ac->bytes,ac->length);
-            idx++;
+            editorAppendHl(ab, seg, seglen, from, to, h);
         }
     }
-    row->rsize = idx;
 }
-/* Insert row at with s and len of s*/
-void editorInsertRow(int at, char *s, size_t len) {
-    if(at < 0 || at > E.numrows) return;
 
-    E.row = realloc(E.row, sizeof(erow) * (E.numrows + 1));
-    // Move row contains chars from cursor to end currently into next row
-    memmove(&E.row[at + 1], &E.row[at], sizeof(erow) * (E.numrows - at));
+/* Build unicode chars of a row from s */
+void editorRowSetText(erow *row, const char *s, size_t len) {
+    // Initalize row append unicode character
+    row->alc = newCharInPool(E.pool);
+    appendNewStringWithLen(row->alc,s,len);
+
+    row->size = getLen(row->alc);
+}
+
+/* Text of a line from the file in the form of E.normOpen, s itself
+ * when it is in the form already. Result lives until the next call */
+const char *editorNormalOpen(const char *s, size_t *len) {
+    static char *buf = NULL;
+    static size_t cap = 0;
+    size_t same = normalizeSpan(E.normOpen, s, *len);
+    if(same == *len) return s;
+
+    size_t need = same + (*len - same) * NORM_GROWTH;
+    if(need > cap) {
+        char *grown = realloc(buf, need);
+        if(grown == NULL) return s;
+        buf = grown;
+        cap = need;
+    }
+    memcpy(buf, s, same);
+    *len = same + normalizeText(E.normOpen, &s[same], *len - same, &buf[same], cap - same);
+    return buf;
+}
 
-    // row start at
-    E.row[at].size = len;
-    E.row[at].chars = malloc(len+1);
-    memcpy(E.row[at].chars, s, len);
-    E.row[at].chars[len] = '\0';
+/* Row from a mapped file is only a view (src, srclen) of its line,
+ * it is loaded when the row is displayed or edited */
+void editorRowLoad(erow *row) {
+    if(row->alc) return;
+    size_t len = row->srclen;
+    const char *s = editorNormalOpen(row->src, &len);
+    editorRowSetText(row, s, len);
+    // Src stays, save writes the row from the file until it is edited
+    // and large mode puts it back there when it is far away
+}
 
-    E.row[at].rsize = 0;
-    E.row[at].render=NULL;
+int editorRowIsLoaded(erow *row) {
+    return row->alc != NULL;
+}
 
-    editorUpdateRow(&E.row[at]);
+/* Text of a row in two parts without loading it */
+void editorRowSegments(erow *row, const char **seg, int *seglen) {
+    if(editorRowIsLoaded(row)) {
+        getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+        return;
+    }
+    seg[0] = row->src;
+    seglen[0] = row->srclen;
+    seg[1] = NULL;
+    seglen[1] = 0;
+}
 
-    // Initalize row append unicode character
-    E.row[at].alc = newChar();
-    appendNewStringWithLen(E.row[at].alc,s,len);
+/* Start of the line after the one ending at p, end of the map when
+ * it is the last one */
+const char *editorLineNext(const char *p) {
+    const char *end = E.map + E.mapsize;
+    while(p < end && *p == '\r')
+        p++;
+    return p < end ? p + 1 : end;
+}
 
-    E.row[at].size = getLen(E.row[at].alc);
+/* Row at index without loading it, NULL when out of range. In large
+ * mode the span holding the line is split, the line gets its own item */
+erow *editorRowRef(int at) {
+    int first;
+    erow *span = ltFind(E.rows, at, &first);
+    if(span == NULL) return NULL;
+    int lines = ltLinesOf(E.rows, span);
+    if(lines == 1) return span;
+
+    const char *end = span->src + span->srclen;
+    const char *line = span->src;
+    for(int i = first; i < at; i++)
+        line = (const char *)memchr(line, '\n', end - line) + 1;
+    const char *nl = memchr(line, '\n', end - line);
+    const char *next = nl ? nl + 1 : end;
+    if(!nl) nl = end;
+    while(nl > line && nl[-1] == '\r')
+        nl--;
+
+    erow *row = span;
+    span->hlIn = 0;
+    if(at == first) {
+        ltSetLines(E.rows, span, 1);
+    } else {
+        // Span keeps the lines before
+        const char *prev = line - 1;
+        while(prev > span->src && prev[-1] == '\r')
+            prev--;
+        span->srclen = prev - span->src;
+        ltSetLines(E.rows, span, at - first);
+        row = ltInsert(E.rows, at);
+        if(row == NULL) die("editorRowRef");
+        row->id = E.nextId++;
+    }
+    row->src = line;
+    row->srclen = nl - line;
+    if(at + 1 < first + lines) {
+        erow *rest = ltInsertSpan(E.rows, at + 1, first + lines - at - 1);
+        if(rest == NULL) die("editorRowRef");
+        rest->src = next;
+        rest->srclen = end - next;
+        rest->id = E.nextId++;
+    }
+    E.largeRows++;
+    return row;
+}
 
-    E.row[at].rsize = 0;
+/* Row at index, NULL when out of range */
+erow *editorRow(int at) {
+    erow *row = editorRowRef(at);
+    if(row) editorRowLoad(row);
+    return row;
+}
 
-    E.row[at].renderAlc=newChar();
+/* Insert row at with s and len of s*/
+void editorInsertRow(int at, char *s, size_t len) {
+    if(at < 0 || at > E.numrows) return;
 
-    editorUpdateUnicodeRow(&E.row[at]);
+    // Rows after at are shifted down by the tree. In large mode the
+    // line at is cut out of its span first, so the new row goes there
+    if(at < E.numrows) editorRowRef(at);
+    erow *row = ltInsert(E.rows, at);
+    if(row == NULL) return;
+
+    editorRowSetText(row, s, len);
+    editorJournal(JOURNAL_INSERT_ROW, at, 0, 0, s, len);
+    editorUndoAdd(UNDO_INSERT_ROW, at, 0, 0, s, len);
+    row->id = E.nextId++;
+    // Rows after at move down, also the ones the index thread has not seen
+    if(at < E.indexNext) E.indexNext++;
+    if(at < E.hlClean) E.hlClean = at;
+    editorIndexRow(row);
 
     E.numrows++;
     E.dirty++;
 }
 
+/* Insert a row which is not loaded yet, s must live as long as the row */
+void editorInsertRowView(int at, const char *s, size_t len) {
+    if(at < 0 || at > E.numrows) return;
+
+    erow *row = ltInsert(E.rows, at);
+    if(row == NULL) return;
+
+    row->src = s;
+    row->srclen = len;
+    row->id = E.nextId++;
+    if(at < E.indexNext) E.indexNext++;
+    if(at < E.hlClean) E.hlClean = at;
+
+    E.numrows++;
+}
+
 void editorFreeRow(erow *row) {
-    free(row->render);
-    free(row->chars);
+    if(!editorRowIsLoaded(row)) return;
+    editorRowDropCols(row);
+    freeChars(row->alc);
 }
 
 void editorDelRow(int at) {
     if(at < 0 || at >= E.numrows) return;
-    editorFreeRow(&E.row[at]);
-    memmove(&E.row[at], &E.row[at + 1], sizeof(erow) * (E.numrows - at - 1));
+    erow *row = editorRowRef(at);
+    editorJournal(JOURNAL_DEL_ROW, at, 0, 0, NULL, 0);
+    if(editorRowIsLoaded(row))
+        editorUndoAdd(UNDO_DEL_ROW, at, 0, 0, getStringPointer(row->alc),
+                      getByteOffset(row->alc, row->size));
+    else
+        editorUndoAdd(UNDO_DEL_ROW, at, 0, 0, row->src, row->srclen);
+    editorIndexForget(row);
+    if(at < E.indexNext) E.indexNext--;
+    if(at < E.hlClean) E.hlClean = at;
+    editorFreeRow(row);
+    ltDelete(E.rows, at);
     E.numrows--;
     E.dirty++;
 }
@@ -404,49 +1102,76 @@ void editorDelRow(int at) {
 void editorRowInsertChar(erow *row, int at, int c) {
     if(at < 0 || at > row->size) at = row->size;
 
-    // Shift left from this cursor characte with the rest line characters
-    // to next character index position
-    // row->size - at + 1, the rest line with current character
-    // When append chars
-    
-    row->chars = realloc(row->chars, row->size + 2);
-    memmove(&row->chars[at+1], &row->chars[at], row->size - at + 1);
-    row->size++;
-
-    // Copy buffer to row chars inserted
-    row->chars[at] = c;
-
-
-    editorUpdateRow(row);
-   
-    // Insert unicode char
+    // Insert unicode char, a code point which can not be encoded
+    // is dropped
     insertChar(row->alc,at,c);
-
-    editorUpdateUnicodeRow(row);
+    if(getLen(row->alc) == row->size) return;
+    row->size++;
+    editorRowColsEdited(row, at, 1);
+    int rowAt = ltIndexOf(E.rows, row);
+    editorJournal(JOURNAL_INSERT_CHAR, rowAt, at, c, NULL, 0);
+    achar *ch = getBucketAt(row->alc, at);
+    if(ch) editorUndoAdd(UNDO_INSERT, rowAt, at, 1, ch->bytes, ch->length);
+    editorIndexRange(row, at - 2, at + 3);
     
     E.dirty++;//Mark changed
 
 }
 
+/* Add utf-8 text s to the end of a row */
 void editorRowAppendString(erow *row, char *s, size_t len) {
-    row->chars = realloc(row->chars, row->size + len + 1);
-    memcpy(&row->chars[row->size], s, len);
-    row->size += len;
-    row->chars[row->size] = '\0';
-    //editorUpdateRow(row);
+    int rowAt = ltIndexOf(E.rows, row);
+    int at = row->size;
+    editorJournal(JOURNAL_APPEND, rowAt, 0, 0, s, len);
+    appendNewStringWithLen(row->alc, s, len);
+    row->size = getLen(row->alc);
+    editorRowColsEdited(row, at, row->size - at);
+    editorUndoAdd(UNDO_INSERT, rowAt, at, row->size - at, s, len);
+    editorIndexRange(row, at - 2, row->size);
+    E.dirty++;
+}
+
+/* Insert utf-8 text without new lines at character at of a row */
+void editorRowInsertString(erow *row, int at, const char *s, size_t len) {
+    if(at < 0 || at > row->size) at = row->size;
+    int rowAt = ltIndexOf(E.rows, row);
+    int size = row->size;
+    editorJournal(JOURNAL_INSERT_TEXT, rowAt, at, 0, s, len);
+    insertString(row->alc, at, s, len);
+    row->size = getLen(row->alc);
+    editorRowColsEdited(row, at, row->size - size);
+    editorUndoAdd(UNDO_INSERT, rowAt, at, row->size - size, s, len);
+    editorIndexRange(row, at - 2, at + row->size - size + 2);
+    E.dirty++;
+}
+
+/* Drop characters of a row from at to its end */
+void editorRowTruncate(erow *row, int at) {
+    if(at < 0 || at >= row->size) return;
+    int rowAt = ltIndexOf(E.rows, row);
+    editorJournal(JOURNAL_TRUNCATE, rowAt, at, 0, NULL, 0);
+    int from = getByteOffset(row->alc, at);
+    editorUndoAdd(UNDO_DELETE, rowAt, at, row->size - at, &getStringPointer(row->alc)[from],
+                  getByteOffset(row->alc, row->size) - from);
+    deleteBuckets(row->alc,at,-1);
+    row->size = at;
+    editorRowColsEdited(row, at, 0);
     E.dirty++;
 }
 
 void editorRowDelChar(erow *row, int at) {
     if(at < 0 || at >= row->size) return;
-    memmove(&row->chars[at], &row->chars[at + 1], row->size - at);
     row->size--;
-    editorUpdateRow(row);
 
     // For unicode char
     alchars alc = row->alc;
+    int rowAt = ltIndexOf(E.rows, row);
+    achar *ch = getBucketAt(alc, at);
+    if(ch) editorUndoAdd(UNDO_DELETE, rowAt, at, 1, ch->bytes, ch->length);
     deleteBucketAt(alc,at);
-    editorUpdateUnicodeRow(row);
+    editorRowColsEdited(row, at, 0);
+    editorJournal(JOURNAL_DEL_CHAR, rowAt, at, 0, NULL, 0);
+    editorIndexRange(row, at - 2, at + 2);
     E.dirty++;
 }
 
@@ -456,78 +1181,413 @@ void editorInsertChar(int c) {
     if(E.cy == E.numrows) {
         editorInsertRow(E.numrows,"",0);
     }
-    editorRowInsertChar(&E.row[E.cy],E.cx,c);
+    editorRowInsertChar(editorRow(E.cy),E.cx,c);
     E.cx++;
 }
 
+/* Type c through the Vietnamese engine, which may change letters of
+ * the word before the cursor. Return 0 when c goes in as it is */
+int editorEngineKey(int c) {
+    if(E.method == GE_OFF || c >= 128 || E.cy >= E.numrows) return 0;
+    erow *row = editorRow(E.cy);
+    // One more than a word, so the engine sees where it starts
+    unsigned text[GE_MAX_WORD + 1];
+    int from = E.cx > GE_MAX_WORD ? E.cx - GE_MAX_WORD - 1 : 0;
+    int len = 0;
+    int i;
+    for(i = from; i < E.cx; i++) {
+        achar *ch = getBucketAt(row->alc, i);
+        int pos = 0;
+        text[len++] = editorNextChar(ch->bytes, ch->length, &pos);
+    }
+
+    geEdit e;
+    if(!geKey(E.method, text, len, c, &e)) return 0;
+    for(i = 0; i < e.count; i++) {
+        editorRowDelChar(row, from + e.at[i]);
+        editorRowInsertChar(row, from + e.at[i], e.cp[i]);
+    }
+    if(e.append) editorInsertChar(e.append);
+    return 1;
+}
+
 /* Insert new line*/
 void editorInsertNewLine() {
     if (E.cx == 0) {
         editorInsertRow(E.cy,"",0);
     } else {
-        /*
-        editorInsertRow(E.cy + 1, &row->chars[E.cx],row->size - E.cx);
-        // Truncate string
-        row = &E.row[E.cy];
-        row->size = E.cx;
-        row->chars[row->size] = '\0';
-        //editorUpdateRow(row);
-        */
-        /* TODOS: Error here Crash whole PC*/
-        char *line = getString(E.row[E.cy].alc);
-        editorInsertRow(E.cy+1, &line[E.cx],E.row[E.cy].size - E.cx);
-        erow *row = &E.row[E.cy]; 
-        alchars alc = row->alc;
-
-        deleteBuckets(alc,E.cx,-1);
-
-        row->size = E.cx;
-        editorUpdateUnicodeRow(&E.row[E.cy]);
-        free(line);
+        erow *row = editorRow(E.cy);
+        const char *line = getStringPointer(row->alc);
+        int from = getByteOffset(row->alc, E.cx);
+        int len = getByteOffset(row->alc, row->size);
+        editorInsertRow(E.cy+1, (char *)&line[from], len - from);
+        editorRowTruncate(row, E.cx);
     }
     E.cy++;
     E.cx = 0;
 }
 
+/* End of the line starting at s, a \r or \n or end */
+const char *editorLineEnd(const char *s, const char *end) {
+    while(s < end && *s != '\n' && *s != '\r') s++;
+    return s;
+}
+
+/* Insert text at the cursor, cursor goes after it. Lines of the text
+ * become rows at once, so each row is changed one time */
+void editorInsertText(const char *s, size_t len) {
+    const char *end = s + len;
+    const char *eol = editorLineEnd(s, end);
+    if(E.cy == E.numrows) editorInsertRow(E.numrows, "", 0);
+    erow *row = editorRow(E.cy);
+    if(eol == end) {
+        int size = row->size;
+        editorRowInsertString(row, E.cx, s, len);
+        E.cx += row->size - size;
+        return;
+    }
+
+    // Rest of the row goes after the last line, both are put together
+    // before anything changes so no memory leaves half a paste
+    const char *lastLine = end;
+    while(lastLine > s && lastLine[-1] != '\n' && lastLine[-1] != '\r') lastLine--;
+    int lastLen = end - lastLine;
+    int from = getByteOffset(row->alc, E.cx);
+    int restLen = getByteOffset(row->alc, row->size) - from;
+    int restSize = row->size - E.cx;
+    char *last = malloc(lastLen + restLen + 1);
+    if(last == NULL) {
+        editorSetStatusMessage("Can't paste! Out of memory");
+        return;
+    }
+    memcpy(last, lastLine, lastLen);
+    memcpy(&last[lastLen], &getStringPointer(row->alc)[from], restLen);
+    editorRowTruncate(row, E.cx);
+    editorRowAppendString(row, (char *)s, eol - s);
+
+    int at = E.cy;
+    const char *line;
+    while(1) {
+        // \r\n is one line end
+        line = eol + (eol + 1 < end && eol[0] == '\r' && eol[1] == '\n' ? 2 : 1);
+        eol = editorLineEnd(line, end);
+        at++;
+        if(eol == end) break;
+        editorInsertRow(at, (char *)line, eol - line);
+    }
+
+    editorInsertRow(at, last, lastLen + restLen);
+    E.cy = at;
+    E.cx = editorRow(at)->size - restSize;
+    free(last);
+}
+
 void editorDelChar() {
     if (E.cy == E.numrows ) return;
     if (E.cx == 0 && E.cy == 0) return;
-    erow *row = &E.row[E.cy];
+    erow *row = editorRow(E.cy);
     if(E.cx > 0) {
-        editorRowDelChar(row,E.cx - 1);
-        E.cx--;
+        // A letter goes with its marks
+        int from = editorRowMoveCluster(row, E.cx, -1);
+        while(E.cx > from) {
+            editorRowDelChar(row,E.cx - 1);
+            E.cx--;
+        }
     } else {
         // When cursor at begin a line
         // And remove back to previous line
-        E.cx = E.row[E.cy - 1].size;
-        editorRowAppendString(&E.row[E.cy - 1], row->chars, row->size);
+        erow *prev = editorRow(E.cy - 1);
+        E.cx = prev->size;
+        editorRowAppendString(prev, (char *)getStringPointer(row->alc),
+                              getByteOffset(row->alc, row->size));
         editorDelRow(E.cy);
         E.cy--;
     }
 }
 
+/*** journal ***/
+
+/* Hidden file next to the opened one: dir/.name<suffix> */
+char *editorSidePath(const char *suffix) {
+    char *path = realpath(E.filename, NULL);
+    if(path == NULL) path = strdup(E.filename);
+    char *slash = strrchr(path, '/');
+    int dirlen = slash ? slash - path + 1 : 0;
+    char *side = malloc(strlen(path) + strlen(suffix) + 2);
+    sprintf(side, "%.*s.%s%s", dirlen, path, path + dirlen, suffix);
+    free(path);
+    return side;
+}
+
+/* Version of the file on disk, a journal only fits the one it began on */
+int editorFileStamp(jnStamp *stamp) {
+    struct stat st;
+    if(E.filename == NULL || stat(E.filename, &st) == -1) return -1;
+    stamp->size = st.st_size;
+    stamp->mtimeSec = st.st_mtim.tv_sec;
+    stamp->mtimeNsec = st.st_mtim.tv_nsec;
+    return 0;
+}
+
+/* Record an edit, the journal is started by the first one */
+void editorJournal(int op, int row, int col, long value, const char *bytes, int len) {
+    if(!E.journalOn) return;
+    if(E.journal == NULL) {
+        jnStamp stamp;
+        if(editorFileStamp(&stamp) == -1) return;
+        char *path = editorSidePath(".ghj");
+        E.journal = jnOpen(path, &stamp, 0, GHI_JOURNAL_SYNC_MS);
+        free(path);
+        if(E.journal == NULL) {
+            // Can not write next to the file, go on without
+            E.journalOn = 0;
+            return;
+        }
+    }
+    jnRecord r = {op, row, col, value, bytes, len};
+    jnAdd(E.journal, &r);
+}
+
+/* Do an edit of the journal again */
+void editorJournalApply(void *ctx, const jnRecord *r) {
+    (void)ctx;
+    erow *row = r->op == JOURNAL_INSERT_ROW ? NULL : editorRow(r->row);
+    switch(r->op) {
+        case JOURNAL_INSERT_CHAR:
+            if(row) editorRowInsertChar(row, r->col, r->value);
+            break;
+        case JOURNAL_DEL_CHAR:
+            if(row) editorRowDelChar(row, r->col);
+            break;
+        case JOURNAL_INSERT_ROW:
+            editorInsertRow(r->row, (char *)r->bytes, r->len);
+            break;
+        case JOURNAL_DEL_ROW:
+            editorDelRow(r->row);
+            break;
+        case JOURNAL_APPEND:
+            if(row) editorRowAppendString(row, (char *)r->bytes, r->len);
+            break;
+        case JOURNAL_TRUNCATE:
+            if(row) editorRowTruncate(row, r->col);
+            break;
+        case JOURNAL_INSERT_TEXT:
+            if(row) editorRowInsertString(row, r->col, r->bytes, r->len);
+            break;
+    }
+}
+
+/* Edits left by a run which did not save are done again, then new
+ * edits go on in the same journal */
+void editorJournalRecover() {
+    jnStamp stamp;
+    if(editorFileStamp(&stamp) == -1) return;
+    char *path = editorSidePath(".ghj");
+    // Edits in the journal are for rows of the whole file
+    if(access(path, F_OK) == 0) editorLoadEnd(0);
+    long n = jnReplay(path, &stamp, editorJournalApply, NULL);
+    if(n > 0) {
+        E.journal = jnOpen(path, &stamp, 1, GHI_JOURNAL_SYNC_MS);
+        editorSetStatusMessage("Recovered %ld edits from the journal", n);
+    } else {
+        // Empty or made for another version of the file
+        unlink(path);
+    }
+    free(path);
+}
+
+/* Changes are saved or thrown away, journal is not needed anymore */
+void editorJournalEnd() {
+    jnClose(E.journal, 1);
+    E.journal = NULL;
+}
+
+/*** undo ***/
+
+/* Record an edit for Ctrl-Z */
+void editorUndoAdd(int op, int row, int col, int count, const char *bytes, int len) {
+    if(E.undo == NULL) return;
+    undoRecord r = {op, row, col, count, 0, bytes, len};
+    undoAdd(E.undo, &r);
+}
+
+/* Put characters of r in its row. Each one of a backspace run was
+ * left of the one before, so they all go in at the same place */
+void editorUndoInsert(erow *row, const undoRecord *r) {
+    if(!r->backward) {
+        editorRowInsertString(row, r->col, r->bytes, r->len);
+        return;
+    }
+    int pos = 0;
+    int at = r->col;
+    while(pos < r->len) {
+        editorRowInsertChar(row, at, editorNextChar(r->bytes, r->len, &pos));
+    }
+}
+
+void editorUndoDelete(erow *row, const undoRecord *r) {
+    if(r->col + r->count >= row->size) {
+        editorRowTruncate(row, r->col);
+        return;
+    }
+    for(int i = 0; i < r->count; i++)
+        editorRowDelChar(row, r->col);
+}
+
+/* Take back the edit of r, or with redo do it again */
+void editorUndoApply(void *ctx, const undoRecord *r, int redo) {
+    (void)ctx;
+    int insert = (r->op == UNDO_INSERT || r->op == UNDO_INSERT_ROW) == (redo != 0);
+    if(r->op == UNDO_INSERT_ROW || r->op == UNDO_DEL_ROW) {
+        if(insert) editorInsertRow(r->row, (char *)r->bytes, r->len);
+        else editorDelRow(r->row);
+        return;
+    }
+
+    erow *row = editorRow(r->row);
+    if(row == NULL) return;
+    if(insert) editorUndoInsert(row, r);
+    else editorUndoDelete(row, r);
+}
+
+void editorUndo(int redo) {
+    if(E.undo == NULL) return;
+    int cx, cy;
+    int done = undoStep(E.undo, redo, editorUndoApply, NULL, &cx, &cy);
+    if(done == -1) {
+        editorSetStatusMessage("Can't undo, the edit was too big for the undo log");
+        return;
+    }
+    if(!done) {
+        editorSetStatusMessage(redo ? "Nothing to redo" : "Nothing to undo");
+        return;
+    }
+    E.cy = cy < E.numrows ? cy : E.numrows;
+    erow *row = editorRow(E.cy);
+    E.cx = row == NULL ? 0 : cx < row->size ? cx : row->size;
+}
+
 /*** File I/O ***/
 
-/**
- * Read from rows characters and store in long string
- */
-char *editorRowsToString(int *buflen) {
-    int totlen = 0;
-    int j;
-    for(j = 0; j < E.numrows; j++) {
-        totlen += E.row[j].size + 1;
-    }
-    *buflen = totlen;
-
-    char *buf = malloc(totlen);
-    char *p = buf;
-    for(j = 0; j < E.numrows; j++) {
-        memcpy(p,E.row[j].chars, E.row[j].size);
-        p += E.row[j].size; // move pointer to next new line
-        *p = '\n';
-        p++;
+/* Give back pages of the map in [from, to) which are read again
+ * from the file when needed, pages at the ends are kept */
+void editorMapDrop(const char *from, const char *to) {
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t lo = (from - E.map + page - 1) / page * page;
+    size_t hi = (to - E.map) / page * page;
+    if(hi > lo) madvise(E.map + lo, hi - lo, MADV_DONTNEED);
+}
+
+/* Put a span of lines from the map at row at */
+void editorInsertSpan(int at, const char *s, size_t len, int lines) {
+    erow *span = ltInsertSpan(E.rows, at, lines);
+    if(span == NULL) die("editorInsertSpan");
+    span->src = s;
+    span->srclen = len;
+    span->id = E.nextId++;
+    E.numrows += lines;
+}
+
+/* Make rows from up to n lines of the map starting at p, after the
+ * last row and without copying them. Large mode only counts lines
+ * into spans and gives back the pages it read. Return where the next
+ * line starts */
+const char *editorLoadLines(const char *p, int n) {
+    const char *end = E.map + E.mapsize;
+    const char *spanStart = p, *spanEnd = p;
+    int lines = 0;
+    while(p < end && n-- > 0) {
+        const char *nl = memchr(p, '\n', end - p);
+        const char *next = nl ? nl + 1 : end;
+        if(!nl) nl = end;
+        // Abandon newline characters
+        while(nl > p && nl[-1] == '\r')
+            nl--;
+        if(!E.large) {
+            editorInsertRowView(E.numrows, p, nl - p);
+        } else {
+            if(lines == GHI_SPAN_LINES || (lines > 0 && nl - spanStart > GHI_SPAN_BYTES)) {
+                editorInsertSpan(E.numrows, spanStart, spanEnd - spanStart, lines);
+                spanStart = p;
+                lines = 0;
+            }
+            spanEnd = nl;
+            lines++;
+        }
+        p = next;
     }
-    return buf;
+    if(lines > 0) editorInsertSpan(E.numrows, spanStart, spanEnd - spanStart, lines);
+    if(E.large && (p - E.loadDrop >= GHI_LARGE_DROP || p == end)) {
+        editorMapDrop(E.loadDrop, p);
+        E.loadDrop = p;
+    }
+    return p;
+}
+
+/* Loader thread, adds the rest of the file in batches and gives the
+ * lock back between, so keys are handled while it runs */
+void *editorLoadWorker(void *arg) {
+    (void)arg;
+    editorLock();
+    while(!E.loadStop && E.loadPos < E.map + E.mapsize) {
+        E.loadPos = editorLoadLines(E.loadPos, GHI_LOAD_BATCH);
+        editorUnlock();
+        editorLock();
+    }
+    E.loading = 0;
+    if(!E.loadStop && editorIndexWanted()) editorIndexStart();
+    editorUnlock();
+    return NULL;
+}
+
+/* Load the map from E.loadPos in the background */
+void editorLoadStart() {
+    E.loading = 1;
+    E.loadStop = 0;
+    if(pthread_create(&E.loadThread, NULL, editorLoadWorker, NULL) != 0) {
+        // No thread, load it all now
+        while(E.loadPos < E.map + E.mapsize)
+            E.loadPos = editorLoadLines(E.loadPos, GHI_LOAD_BATCH);
+        E.loading = 0;
+        return;
+    }
+    E.loader = 1;
+}
+
+/* Wait for the loader to add all rows, with stop it ends early */
+void editorLoadEnd(int stop) {
+    if(!E.loader) return;
+    if(stop) E.loadStop = 1;
+    editorUnlock();
+    pthread_join(E.loadThread, NULL);
+    editorLock();
+    E.loader = 0;
+}
+
+/* Drop all rows, their memory is released with the pool at once */
+void editorClose() {
+    editorLoadEnd(1);
+    editorIndexStop();
+    editorJournalEnd();
+    undoFree(E.undo);
+    E.undo = NULL;
+    ltFree(E.rows);
+    poolRelease(E.pool);
+    if(E.map) munmap(E.map, E.mapsize);
+    E.map = NULL;
+    E.mapsize = 0;
+    E.large = 0;
+    E.largeRows = 0;
+    E.largeSweep = 0;
+    E.hlClean = 0;
+
+    E.pool = poolNew();
+    E.rows = ltNew(sizeof(erow), E.pool);
+    E.numrows = 0;
+    E.nextId = 0;
+    E.cx = E.cy = 0;
+    E.rowoff = E.coloff = 0;
+    E.dirty = 0;
 }
 
 void editorOpen(char *filename) {
@@ -537,6 +1597,24 @@ void editorOpen(char *filename) {
     FILE *fp = fopen(filename,"r");
     if(!fp) die("fopen");
 
+    // Map a regular file, rows only point into it until they are used
+    struct stat st;
+    if(fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+        if(map != MAP_FAILED) {
+            E.map = map;
+            E.mapsize = st.st_size;
+            E.large = E.largeBytes && (size_t)st.st_size >= E.largeBytes;
+            // First screen is there at once, the rest comes in the background
+            E.loadDrop = map;
+            E.loadPos = editorLoadLines(map, E.screenrows);
+            if(E.loadPos < map + E.mapsize) editorLoadStart();
+            fclose(fp);
+            E.dirty = 0;
+            return;
+        }
+    }
+
     char *line = NULL;
     size_t linecap = 0;
     ssize_t linelen;
@@ -546,13 +1624,50 @@ void editorOpen(char *filename) {
         while(linelen > 0 && (line[linelen - 1] == '\n' ||
                               line[linelen - 1] == '\r'))
             linelen--;
-        editorInsertRow(E.numrows,line,linelen);
+        size_t len = linelen;
+        const char *s = editorNormalOpen(line, &len);
+        editorInsertRow(E.numrows,(char *)s,len);
     }
     free(line);
     fclose(fp);
     E.dirty = 0;
 }
 
+/* Write all of iov, writev may stop after a part of it */
+int editorWriteAll(int fd, struct iovec *iov, int cnt) {
+    while(cnt > 0) {
+        ssize_t n = writev(fd, iov, cnt);
+        if(n == -1) {
+            if(errno == EINTR) continue;
+            return -1;
+        }
+        while(cnt > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if(cnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+    return 0;
+}
+
+/* Show how far a save is, at most every 100 ms so short saves show nothing */
+void editorSaveProgress(int row, struct timespec *last) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long ms = (now.tv_sec - last->tv_sec) * 1000 + (now.tv_nsec - last->tv_nsec) / 1000000;
+    if(ms < 100) return;
+    *last = now;
+    editorSetStatusMessage("Saving... %d%%", (int)(row * 100LL / E.numrows));
+    editorRefreshScreen();
+}
+
+/* Rows are written straight from where they live into a new file next
+ * to the old one, which takes its place by rename once it is on disk.
+ * A crash leaves either the old or the new file */
 void editorSave() {
     if (E.filename == NULL) {
         E.filename = editorPrompt("Save as: %s",NULL);
@@ -562,36 +1677,455 @@ void editorSave() {
         }
     }
 
-    int len;
-    char *buf = editorRowsToString(&len);
-
-    // Open creat a new file and Read write to a file
-    int fd = open(E.filename, O_RDWR | O_CREAT, 0644);
-    // 0644 si standard permissions you usally want for text file
-    // see more: http://www.filepermissions.com/directory-permission/0644
-    if (fd != -1) {
-        // set file size
-        if(ftruncate(fd,len) != -1) {
-            // Write to file
-            if(write(fd,buf,len) == len) {
-                close(fd);
-                free(buf);
-                E.dirty = 0;
-                editorSetStatusMessage("%d bytes written to disk", len);
-                return;
+    // Replace the file a link points to, not the link
+    char *path = realpath(E.filename, NULL);
+    if(path == NULL) path = strdup(E.filename);
+    char *slash = strrchr(path, '/');
+    int dirlen = slash ? slash - path + 1 : 0;
+    char *tmp = editorSidePath(".XXXXXX");
+
+    int fd = mkstemp(tmp);
+    if(fd == -1) {
+        editorSetStatusMessage("Can't save! I/O error: %s",strerror(errno));
+        free(tmp);
+        free(path);
+        return;
+    }
+    // Keep permissions of the old file, new file gets 0644
+    struct stat st;
+    if(stat(path, &st) == 0) {
+        fchmod(fd, st.st_mode & 07777);
+    } else {
+        mode_t mask = umask(0);
+        umask(mask);
+        fchmod(fd, 0644 & ~mask);
+    }
+
+    static char newline = '\n';
+    struct iovec iov[GHI_SAVE_IOV];
+    int cnt = 0;
+    long long total = 0;
+    int ok = 1;
+    struct timespec last;
+    clock_gettime(CLOCK_MONOTONIC, &last);
+    // Normalized text of rows waiting in iov
+    char *norm = NULL;
+    size_t normLen = 0, normCap = 0;
+    int j = 0;
+    erow *row;
+    const char *saved = E.map;
+    for(row = ltGet(E.rows, 0); ok && row; row = ltNext(E.rows, row)) {
+        // Both parts of the text around the gap, then new line. A span
+        // of large mode is its lines as they are in the file, so is a
+        // row which was not edited, with bytes loading drops
+        const char *seg[2];
+        int seglen[2];
+        int lines = ltLinesOf(E.rows, row);
+        j += lines;
+        if(row->src && !row->edited) {
+            seg[0] = row->src;
+            seglen[0] = row->srclen;
+            seg[1] = NULL;
+            seglen[1] = 0;
+        } else {
+            editorRowSegments(row, seg, seglen);
+        }
+        // Lines of a span with \r go one by one without it, as a row
+        // of a line does
+        const char *line = NULL, *spanEnd = NULL;
+        if(lines > 1 && memchr(seg[0], '\r', seglen[0])) {
+            line = seg[0];
+            spanEnd = seg[0] + seglen[0];
+        } else {
+            lines = 1;
+        }
+        for(int k = 0; ok && k < lines; k++) {
+            if(line) {
+                const char *nl = memchr(line, '\n', spanEnd - line);
+                const char *next = nl ? nl + 1 : spanEnd;
+                if(!nl) nl = spanEnd;
+                while(nl > line && nl[-1] == '\r')
+                    nl--;
+                seg[0] = line;
+                seglen[0] = nl - line;
+                seg[1] = NULL;
+                seglen[1] = 0;
+                line = next;
+            }
+            if(E.normSave && seglen[1] > 0) {
+                // Marks after the gap may join the character before it
+                seg[0] = getStringPointer(row->alc);
+                seglen[0] += seglen[1];
+                seg[1] = NULL;
+                seglen[1] = 0;
+            }
+            size_t same = normalizeSpan(E.normSave, seg[0], seglen[0]);
+            if(same < (size_t)seglen[0]) {
+                // Part in the form as it is, then the rest normalized
+                size_t need = (seglen[0] - same) * NORM_GROWTH;
+                if(normLen + need > normCap) {
+                    if(cnt > 0) ok = editorWriteAll(fd, iov, cnt) == 0;
+                    cnt = 0;
+                    normLen = 0;
+                    if(need > normCap) {
+                        normCap = need > GHI_SAVE_NORM_BYTES ? need : GHI_SAVE_NORM_BYTES;
+                        free(norm);
+                        norm = malloc(normCap);
+                        if(norm == NULL) normCap = 0;
+                    }
+                    if(!ok || norm == NULL) {
+                        ok = 0;
+                        break;
+                    }
+                }
+                seg[1] = &norm[normLen];
+                seglen[1] = normalizeText(E.normSave, &seg[0][same], seglen[0] - same,
+                                          &norm[normLen], need);
+                seglen[0] = same;
+                normLen += seglen[1];
+            }
+            iov[cnt].iov_base = (void *)seg[0];
+            iov[cnt].iov_len = seglen[0];
+            iov[cnt + 1].iov_base = (void *)seg[1];
+            iov[cnt + 1].iov_len = seglen[1];
+            iov[cnt + 2].iov_base = &newline;
+            iov[cnt + 2].iov_len = 1;
+            cnt += 3;
+            total += seglen[0] + seglen[1] + 1;
+            if(cnt == GHI_SAVE_IOV) {
+                ok = editorWriteAll(fd, iov, cnt) == 0;
+                cnt = 0;
+                normLen = 0;
+                editorSaveProgress(j, &last);
+                // Lines of a large file which were written are not needed
+                if(E.large && row->src && row->src > saved) {
+                    editorMapDrop(saved, row->src);
+                    saved = row->src;
+                }
             }
         }
-        close(fd);
     }
-    free(buf);
-    editorSetStatusMessage("Can't save! I/O error: %s",strerror(errno));
+    if(ok && cnt > 0) ok = editorWriteAll(fd, iov, cnt) == 0;
+    free(norm);
+    if(ok) ok = fsync(fd) == 0;
+    if(close(fd) == -1) ok = 0;
+    if(ok) ok = rename(tmp, path) == 0;
+
+    if(ok) {
+        // Make the rename itself durable
+        char *dir = dirlen ? strndup(path, dirlen) : strdup(".");
+        int dfd = open(dir, O_RDONLY);
+        if(dfd != -1) {
+            fsync(dfd);
+            close(dfd);
+        }
+        free(dir);
+        E.dirty = 0;
+        editorJournalEnd();
+        editorSetStatusMessage("%lld bytes written to disk", total);
+    } else {
+        editorSetStatusMessage("Can't save! I/O error: %s",strerror(errno));
+        unlink(tmp);
+    }
+    free(tmp);
+    free(path);
+}
+
+/*** index ***/
+
+/* Remember row of id so a hit of the index leads back to the row */
+void editorIndexSetRow(erow *row) {
+    if(row->id >= E.idCap) {
+        unsigned cap = E.idCap ? E.idCap : 1024;
+        while(cap <= row->id) cap *= 2;
+        erow **rows = realloc(E.idRows, cap * sizeof(erow *));
+        if(rows == NULL) return;
+        memset(&rows[E.idCap], 0, (cap - E.idCap) * sizeof(erow *));
+        E.idRows = rows;
+        E.idCap = cap;
+    }
+    E.idRows[row->id] = row;
+}
+
+/* Add all trigrams of a row */
+void editorIndexRow(erow *row) {
+    if(E.index == NULL) return;
+    editorIndexSetRow(row);
+    const char *seg[2];
+    int seglen[2];
+    editorRowSegments(row, seg, seglen);
+    triAdd(E.index, row->id, seg[0], seglen[0], seg[1], seglen[1]);
+}
+
+/* Add trigrams of characters from to to of a row, after an edit in
+ * between. Old trigrams stay, search checks every row it is given */
+void editorIndexRange(erow *row, int from, int to) {
+    if(E.index == NULL) return;
+    if(from < 0) from = 0;
+    if(to > getLen(row->alc)) to = getLen(row->alc);
+    if(to - from < 3) return;
+
+    const char *seg[2];
+    int seglen[2];
+    getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+    int start = getByteOffset(row->alc, from);
+    int end = getByteOffset(row->alc, to);
+    // Cut the byte range out of both parts
+    int end1 = end < seglen[0] ? end : seglen[0];
+    int start2 = start > seglen[0] ? start - seglen[0] : 0;
+    triAdd(E.index, row->id,
+           seg[0] + (start < end1 ? start : 0), start < end1 ? end1 - start : 0,
+           seg[1] + start2, end > seglen[0] ? end - seglen[0] - start2 : 0);
+}
+
+void editorIndexForget(erow *row) {
+    if(row->id < E.idCap) E.idRows[row->id] = NULL;
+}
+
+/* Index thread, adds rows in batches and gives the lock back between */
+void *editorIndexWorker(void *arg) {
+    (void)arg;
+    editorLock();
+    while(!E.indexStop && E.indexNext < E.numrows) {
+        int end = E.indexNext + GHI_INDEX_BATCH;
+        for(; E.indexNext < end && E.indexNext < E.numrows; E.indexNext++)
+            editorIndexRow(ltGet(E.rows, E.indexNext));
+        editorUnlock();
+        editorLock();
+    }
+    if(!E.indexStop) E.indexReady = 1;
+    editorUnlock();
+    return NULL;
+}
+
+/* GHI_INDEX=1 is set, a large file is never indexed as the index
+ * would hold all of its lines */
+int editorIndexWanted() {
+    return getenv("GHI_INDEX") && !E.large;
+}
+
+/* Build the index of the opened rows in the background */
+void editorIndexStart() {
+    E.index = triNew();
+    if(E.index == NULL) return;
+    E.indexNext = 0;
+    E.indexReady = 0;
+    E.indexStop = 0;
+    if(pthread_create(&E.indexThread, NULL, editorIndexWorker, NULL) != 0) {
+        triFree(E.index);
+        E.index = NULL;
+    }
+}
+
+void editorIndexStop() {
+    if(E.index == NULL) return;
+    E.indexStop = 1;
+    editorUnlock();
+    pthread_join(E.indexThread, NULL);
+    editorLock();
+    triFree(E.index);
+    free(E.idRows);
+    E.index = NULL;
+    E.idRows = NULL;
+    E.idCap = 0;
+    E.indexNext = 0;
+    E.indexReady = 0;
 }
 
 /*** find ***/
 
+/* Row is not loaded and loading keeps its file text as it is, so byte
+ * offsets in src hold for the loaded row. Loading drops bytes which
+ * are not utf-8 and may normalize the rest */
+int editorRowSrcAsLoaded(erow *row) {
+    return !editorRowIsLoaded(row) && utf8Validate(row->src, row->srclen) &&
+           normalizeSpan(E.normOpen, row->src, row->srclen) == (size_t)row->srclen;
+}
+
+/* Column of the first match of any of npat patterns in row starting
+ * at or after column from, -1 when none. A row not loaded yet is
+ * searched in the mapped file, unless loading changes its text */
+int editorRowFind(erow *row, searchPattern *pat, int npat, int from) {
+    long off = -1;
+    if(editorRowSrcAsLoaded(row)) {
+        size_t start = utf8Offset(row->src, row->srclen, from);
+        for(int i = 0; i < npat; i++) {
+            long r = searchFindSplit(&pat[i], row->src, row->srclen, NULL, 0, start);
+            if(r >= 0 && (off < 0 || r < off)) off = r;
+        }
+        return off < 0 ? -1 : (int)utf8Count(row->src, off);
+    }
+
+    editorRowLoad(row);
+    const char *seg[2];
+    int seglen[2];
+    getSegments(row->alc, &seg[0], &seglen[0], &seg[1], &seglen[1]);
+    int start = getByteOffset(row->alc, from);
+    for(int i = 0; i < npat; i++) {
+        long r = searchFindSplit(&pat[i], seg[0], seglen[0], seg[1], seglen[1], start);
+        if(r >= 0 && (off < 0 || r < off)) off = r;
+    }
+    return off < 0 ? -1 : getIndexOfByte(row->alc, off);
+}
+
+/* Text of a row for search workers, the row is only read. In large
+ * mode ctx has the items of the tree and at is one of them */
+void editorRowText(void *ctx, int at, const char **first, size_t *firstLen,
+                   const char **second, size_t *secondLen) {
+    erow *row = ctx ? ((erow **)ctx)[at] : ltGet(E.rows, at);
+    if(!editorRowIsLoaded(row)) {
+        *first = row->src;
+        *firstLen = row->srclen;
+        *second = NULL;
+        *secondLen = 0;
+        return;
+    }
+    int len1, len2;
+    getSegments(row->alc, first, &len1, second, &len2);
+    *firstLen = len1;
+    *secondLen = len2;
+}
+
+/* Column of the last match in row starting before column before */
+int editorRowFindLast(erow *row, searchPattern *pat, int npat, int before) {
+    int last = -1;
+    int col = editorRowFind(row, pat, npat, 0);
+    while(col >= 0 && col < before) {
+        last = col;
+        col = editorRowFind(row, pat, npat, col + 1);
+    }
+    return last;
+}
+
+/* Large mode: all items of the tree in order into *items, return
+ * their count. Row *current is split out first so the search starts
+ * right after it, *current becomes its item */
+int editorLargeItems(erow ***items, int *current) {
+    erow *cur = *current >= 0 ? editorRowRef(*current) : NULL;
+    int count = 0;
+    for(erow *row = ltGet(E.rows, 0); row; row = ltNext(E.rows, row))
+        count++;
+    *items = malloc(count * sizeof(erow *));
+    if(*items == NULL) die("editorLargeItems");
+    count = 0;
+    for(erow *row = ltGet(E.rows, 0); row; row = ltNext(E.rows, row)) {
+        if(row == cur) *current = count;
+        (*items)[count++] = row;
+    }
+    return count;
+}
+
+/* Row of a search hit at byte offset of item */
+int editorLargeHitRow(erow *item, size_t offset) {
+    int at = ltIndexOf(E.rows, item);
+    if(ltLinesOf(E.rows, item) == 1) return at;
+    for(const char *p = item->src; (p = memchr(p, '\n', offset - (p - item->src))); p++)
+        at++;
+    return at;
+}
+
+/* Nearest row from current in direction which has a match, only rows
+ * from the index are looked at. Return column and set current, -1
+ * when none, -2 when too many rows are given so a scan is faster */
+typedef struct findCandidate {
+    int step; // Rows away from current in the search direction
+    int at;
+    erow *row;
+} findCandidate;
+
+int findCandidateCmp(const void *a, const void *b) {
+    return ((const findCandidate *)a)->step - ((const findCandidate *)b)->step;
+}
+
+int editorFindIndexed(searchPattern *pat, int npat, int *current, int direction) {
+    // Rows which may hold any of the patterns
+    unsigned *ids = NULL;
+    long n = 0;
+    for(int k = 0; k < npat; k++) {
+        unsigned *more;
+        long m = triQuery(E.index, pat[k].needle, pat[k].len, &more);
+        if(m < 0) {
+            free(ids);
+            return -2;
+        }
+        unsigned *all = m > 0 ? realloc(ids, (n + m) * sizeof(unsigned)) : ids;
+        if(all && m > 0) {
+            memcpy(&all[n], more, m * sizeof(unsigned));
+            ids = all;
+            n += m;
+        }
+        free(more);
+    }
+    if(n <= 0) {
+        free(ids);
+        return -1;
+    }
+    if(n > E.numrows / GHI_INDEX_MAX_PART) {
+        free(ids);
+        return -2;
+    }
+
+    findCandidate *cand = malloc(n * sizeof(findCandidate));
+    long i, m = 0;
+    for(i = 0; cand && i < n; i++) {
+        erow *row = ids[i] < E.idCap ? E.idRows[ids[i]] : NULL;
+        if(row == NULL) continue;
+        int at = ltIndexOf(E.rows, row);
+        int step = ((at - *current) * direction) % E.numrows;
+        if(step <= 0) step += E.numrows;
+        cand[m].step = step;
+        cand[m].at = at;
+        cand[m].row = row;
+        m++;
+    }
+    free(ids);
+    if(cand == NULL) return -1;
+    qsort(cand, m, sizeof(findCandidate), findCandidateCmp);
+
+    int col = -1;
+    for(i = 0; col < 0 && i < m; i++) {
+        // A row given for both patterns is looked at once
+        if(i > 0 && cand[i].row == cand[i - 1].row) continue;
+        if(direction == 1)
+            col = editorRowFind(cand[i].row, pat, npat, 0);
+        else
+            col = editorRowFindLast(cand[i].row, pat, npat, INT_MAX);
+        if(col >= 0) *current = cand[i].at;
+    }
+    free(cand);
+    return col;
+}
+
+/* Patterns of query in NFC and NFD, a file may hold either form. The
+ * second one is only made when it differs. Needles live until the
+ * next call */
+int editorFindPatterns(const char *query, searchPattern *pat) {
+    static char *forms[2];
+    static size_t cap[2];
+    static const int form[2] = {NORM_NFC, NORM_NFD};
+    size_t len = strlen(query);
+    int npat = 0;
+    for(int k = 0; k < 2; k++) {
+        size_t need = len * NORM_GROWTH + 1;
+        if(need > cap[k]) {
+            char *grown = realloc(forms[k], need);
+            if(grown == NULL) continue;
+            forms[k] = grown;
+            cap[k] = need;
+        }
+        size_t n = normalizeText(form[k], query, len, forms[k], cap[k]);
+        if(npat == 1 && n == pat[0].len && memcmp(forms[k], pat[0].needle, n) == 0)
+            continue;
+        searchCompile(&pat[npat++], forms[k], n);
+    }
+    if(npat == 0) searchCompile(&pat[npat++], query, len);
+    return npat;
+}
+
 void editorFindCallback(char *query, int key) {
     /* Search forward and backward*/
     static int last_match = -1;
+    static int last_col = -1;
     static int direction = 1;
 
     if(key == '\r' || key == '\x1b') {
@@ -608,24 +2142,101 @@ void editorFindCallback(char *query, int key) {
     }
     if(last_match == -1) direction = 1;
     int current = last_match;
+    int from = current;
+
+    searchPattern pat[2];
+    int npat = editorFindPatterns(query, pat);
+
+    // Next match on the same line first
+    int col = -1;
+    if(current >= 0 && current < E.numrows) {
+        erow *row = editorRowRef(current);
+        if(direction == 1)
+            col = editorRowFind(row, pat, npat, last_col + 1);
+        else
+            col = editorRowFindLast(row, pat, npat, last_col);
+    }
+
+    // Whole file in the index, only its rows are searched
+    int indexed = col < 0 && E.indexReady && getStringLen(query) >= 3;
+    if(indexed) {
+        col = editorFindIndexed(pat, npat, &current, direction);
+        if(col == -2) {
+            indexed = 0;
+            col = -1;
+        }
+    }
+    if(col < 0 && !indexed && (E.numrows >= GHI_FIND_THREADS_ROWS || E.large)) {
+        searchHit hit;
+        erow **items = NULL;
+        int count = E.numrows, start = current;
+        if(E.large) count = editorLargeItems(&items, &start);
+        searchStart(pat, npat, count, start, direction, editorRowText, items);
+        while(!searchWait(&hit, 20)) {
+            if(editorKeyPending()) {
+                // Query is changing, look again with the next one
+                searchCancel();
+                free(items);
+                return;
+            }
+            // Pages the workers read stay in memory until given back
+            if(E.large) editorMapDrop(E.map, E.map + E.mapsize);
+        }
+        if(hit.item >= 0 && items) {
+            // Hit is in a span, the row is cut out of it and looked at again
+            current = editorLargeHitRow(items[hit.item], hit.offset);
+            erow *row = editorRowRef(current);
+            if(direction == 1)
+                col = editorRowFind(row, pat, npat, 0);
+            else
+                col = editorRowFindLast(row, pat, npat, INT_MAX);
+        } else if(hit.item >= 0) {
+            current = hit.item;
+            erow *row = ltGet(E.rows, current);
+            if(editorRowIsLoaded(row) || editorRowSrcAsLoaded(row)) {
+                editorRowLoad(row);
+                col = getIndexOfByte(row->alc, hit.offset);
+            } else if(direction == 1) {
+                // Offset was in the file text, loading changes it
+                col = editorRowFind(row, pat, npat, 0);
+            } else {
+                col = editorRowFindLast(row, pat, npat, INT_MAX);
+            }
+        }
+        free(items);
+        E.largeSweep = E.large;
+    }
 
     int i;
-    for(i = 0; i < E.numrows; i++) {
+    int scan = !indexed && !E.large && E.numrows < GHI_FIND_THREADS_ROWS;
+    for(i = 0; col < 0 && scan && i < E.numrows; i++) {
         current += direction;
         // go to tail of file
         if(current == -1) current = E.numrows - 1;
         // Go to head file for search
         else if(current == E.numrows) current = 0;
 
-        erow *row = &E.row[current];
-        char *match = strstr(row->render, query);
-        if(match) {
-            last_match = current;
-            E.cy = current;
-            E.cx = editorRowRxToCx(row,match - row->render);
-            E.rowoff = E.numrows;
-            break;
-        }
+        erow *row = ltGet(E.rows, current);
+        if(direction == 1)
+            col = editorRowFind(row, pat, npat, 0);
+        else
+            col = editorRowFindLast(row, pat, npat, INT_MAX);
+    }
+
+    // Only rows loaded when the search started were looked at, the
+    // rest of the file may still have a match
+    if(E.loading && (col < 0 || (direction == 1 ? current < from : current > from))) {
+        char msg[sizeof(E.statusmsg)];
+        snprintf(msg, sizeof(msg), "%s", E.statusmsg);
+        editorSetStatusMessage("Still loading, %d rows searched - %s", E.numrows, msg);
+    }
+
+    if(col >= 0) {
+        last_match = current;
+        last_col = col;
+        E.cy = current;
+        E.cx = editorRowClusterStart(editorRow(current), col);
+        E.rowoff = E.numrows;
     }
 }
 
@@ -650,10 +2261,67 @@ void editorFind() {
 
 /*** Output ***/
 
+/* Two items of the map follow each other in the file */
+int editorLargeTouch(erow *a, erow *b) {
+    return b->src == editorLineNext(a->src + a->srclen);
+}
+
+/* Large mode: rows far from the screen which were not edited go back
+ * into spans, pages of the map far from the screen are given back */
+void editorLargeSweep() {
+    int lo = E.rowoff - GHI_LARGE_WINDOW;
+    int hi = E.rowoff + E.screenrows + GHI_LARGE_WINDOW;
+    const char *keepFrom = NULL, *keepTo = NULL; // Map used by rows near the screen
+    erow *prev = NULL; // Span or view before row, NULL when it can not grow
+    int at = 0;
+    erow *row = ltGet(E.rows, 0);
+    while(row) {
+        erow *next = ltNext(E.rows, row);
+        int lines = ltLinesOf(E.rows, row);
+        if(at + lines > lo && at < hi) {
+            if(row->src && !keepFrom) keepFrom = row->src;
+            if(row->src) keepTo = row->src + row->srclen;
+            prev = NULL;
+        } else {
+            if(row->src && !row->edited && editorRowIsLoaded(row)) {
+                editorFreeRow(row);
+                row->alc = NULL;
+                row->size = 0;
+            }
+            if(editorRowIsLoaded(row) || row->src == NULL) {
+                prev = NULL;
+            } else if(prev && ltLinesOf(E.rows, prev) + lines <= GHI_SPAN_LINES &&
+                      row->src + row->srclen - prev->src <= GHI_SPAN_BYTES &&
+                      editorLargeTouch(prev, row)) {
+                // Row is taken out, prev grows by its lines
+                prev->srclen = row->src + row->srclen - prev->src;
+                prev->hlIn = 0;
+                int prevLines = ltLinesOf(E.rows, prev);
+                ltDelete(E.rows, at);
+                ltSetLines(E.rows, prev, prevLines + lines);
+            } else {
+                prev = row;
+            }
+        }
+        at += lines;
+        row = next;
+    }
+
+    if(keepFrom == NULL) keepFrom = keepTo = E.map + E.mapsize;
+    editorMapDrop(E.map, keepFrom);
+    editorMapDrop(keepTo, E.map + E.mapsize);
+    E.largeRows = 0;
+    E.largeSweep = 0;
+}
+
 void editorScroll() {
     E.rx = 0;
+    int rxEnd = 1; // Column after the cursor character, wide ones take two
     if(E.cy < E.numrows) {
-        E.rx = editorRowCxToRx(&E.row[E.cy], E.cx);
+        erow *row = editorRow(E.cy);
+        E.rx = editorRowCxToRx(row, E.cx);
+        rxEnd = editorRowCxToRx(row, editorRowMoveCluster(row, E.cx, 1));
+        if(rxEnd != E.rx + 2) rxEnd = E.rx + 1;
     }
 
     // scroll vertical
@@ -665,17 +2333,118 @@ void editorScroll() {
     }
 
     // scroll horizontal
-    if(E.cx < E.coloff) {
+    if(E.rx < E.coloff) {
         E.coloff = E.rx;
     }
-    if(E.cx >= E.coloff + E.screencols) {
-        E.coloff = E.rx = E.screencols + 1;
+    if(rxEnd > E.coloff + E.screencols) {
+        E.coloff = rxEnd - E.screencols;
     }
 }
 
-void editorDrawRows(struct abuf *ab) {
+/* Rows are drawn with markdown highlight: GHI_MARKDOWN=1 or 0 says
+ * so, otherwise .md and .markdown files and new ones without a name */
+int editorHlOn() {
+    if(E.hlMode != -1) return E.hlMode;
+    if(E.filename == NULL) return 1;
+    const char *dot = strrchr(E.filename, '.');
+    return dot && (!strcasecmp(dot, ".md") || !strcasecmp(dot, ".markdown"));
+}
+
+/* Text of a row in one piece, a loaded row with its gap inside is
+ * copied. Result lives until the next call */
+const char *editorRowLine(erow *row, int *len) {
+    static char *buf = NULL;
+    static int cap = 0;
+    const char *seg[2];
+    int seglen[2];
+    editorRowSegments(row, seg, seglen);
+    *len = seglen[0];
+    if(seglen[1] == 0) return seg[0];
+    if(seglen[0] + seglen[1] > cap) {
+        char *grown = realloc(buf, seglen[0] + seglen[1]);
+        if(grown == NULL) return seg[0];
+        buf = grown;
+        cap = seglen[0] + seglen[1];
+    }
+    memcpy(buf, seg[0], seglen[0]);
+    memcpy(&buf[seglen[0]], seg[1], seglen[1]);
+    *len = seglen[0] + seglen[1];
+    return buf;
+}
+
+/* State after the lines of item, a row or a span of large mode, which
+ * starts in state. It is kept in the item and only read again when
+ * the item changed or starts in another state */
+int editorHlItem(erow *item, int state) {
+    if(item->hlIn == state) return item->hlOut;
+    int lines = ltLinesOf(E.rows, item);
+    int out = state;
+    if(lines == 1) {
+        int len;
+        const char *s = editorRowLine(item, &len);
+        out = mdLine(state, s, len, NULL, 0, NULL);
+    } else {
+        const char *p = item->src, *end = item->src + item->srclen;
+        for(int i = 0; i < lines; i++) {
+            const char *nl = memchr(p, '\n', end - p);
+            const char *next = nl ? nl + 1 : end;
+            if(!nl) nl = end;
+            while(nl > p && nl[-1] == '\r')
+                nl--;
+            out = mdLine(out, p, nl - p, NULL, 0, NULL);
+            p = next;
+        }
+        // Pages of the map read here are given back before the next key
+        E.largeSweep = 1;
+    }
+    item->hlIn = state;
+    item->hlOut = out;
+    return out;
+}
+
+/* Markdown state at the start of row at. Rows from E.hlClean on are
+ * looked at up to at, the ones starting in the state they had before
+ * are not read again, so after an edit rows are read until one ends
+ * the way it did */
+int editorHlState(int at) {
+    editorRowRef(at); // Row gets an item of its own in large mode
+    int first;
+    erow *item = ltFind(E.rows, at < E.hlClean ? at : E.hlClean, &first);
+    // Back to an item whose state is known, new and split ones do not know it
+    while(first > 0 && (item->hlIn == 0 || first >= E.hlClean))
+        item = ltFind(E.rows, first - 1, &first);
+    int state = item->hlIn ? item->hlIn : MD_START;
+    while(first < at) {
+        state = editorHlItem(item, state);
+        first += ltLinesOf(E.rows, item);
+        item = ltNext(E.rows, item);
+    }
+    if(at > E.hlClean) E.hlClean = at;
+    return state;
+}
+
+/* Highlight of row at which starts in state to h, return its end state */
+int editorHlRow(erow *row, int at, int state, mdSpan *spans, rowHl *h) {
+    int len;
+    const char *s = editorRowLine(row, &len);
+    int out = mdLine(state, s, len, spans, GHI_HL_SPANS, &h->count);
+    h->spans = spans;
+    h->next = 0;
+    h->hl = MD_NORMAL;
+    row->hlIn = state;
+    row->hlOut = out;
+    if(E.hlClean == at) E.hlClean = at + 1;
+    return out;
+}
+
+void editorDrawRows() {
+    mdSpan spans[GHI_HL_SPANS];
+    int hl = editorHlOn() && E.rowoff < E.numrows;
+    // Only rows on screen get their spans, the ones above give the state
+    int state = hl ? editorHlState(E.rowoff) : MD_START;
     int y;
     for( y = 0; y < E.screenrows; y++ ) {
+        struct abuf *ab = &E.frame[y];
         int filerow = y + E.rowoff;
         if(filerow >= E.numrows) {
             // Write information version in the midle
@@ -697,47 +2466,60 @@ void editorDrawRows(struct abuf *ab) {
             }
 
         } else {
-            /*
-            int len = E.row[filerow].rsize - E.coloff;
-            if (len < 0) len = 0;
-            if(len > E.screencols) len = E.screencols;
-            char *c = &E.row[filerow].render[E.coloff];
-            int j;
-            for(j = 0; j < len; j++) {
-                if(isdigit(c[j])) {
-                    abAppend(ab,"\x1b[31m",5);
-                    abAppend(ab,&c[j],1);
-                    abAppend(ab,"\x1b[39m",5);
-                }else {
-                    abAppend(ab,&c[j],1);
-                }
-            }
-            */
-
             /*Render unicode*/
-            alchars alc = E.row[filerow].renderAlc;
-            int len = getLen(alc) - E.coloff;
-            if(len < 0) len = 0;
-            if(len > E.screencols) len = E.screencols;
-            int j;
-            for(j = 0; j < len; j++) {
-                achar *ac = getBucketAt(alc,j);
-                abAppend(ab,ac->bytes,ac->length);
+            erow *row = editorRow(filerow);
+            if(!hl) {
+                editorDrawRowText(ab, row, NULL);
+                continue;
             }
+            rowHl h;
+            state = editorHlRow(row, filerow, state, spans, &h);
+            editorDrawRowText(ab, row, &h);
+            if(h.hl != MD_NORMAL) editorHlSwitch(ab, &h, MD_NORMAL);
         }
-        abAppend(ab,"\x1b[K",3);// Clear a line before add line to display out
-        abAppend(ab,"\r\n",2);
     }
 }
 
 void editorDrawStatusBar(struct abuf *ab) {
     abAppend(ab,"\x1b[7m",4); // switch to inverted colors
-    char status[80],rstatus[80];
-    int len = snprintf(status, sizeof(status),"%.20s - %d lines %s",
+    char status[80],rstatus[128];
+    char load[24] = "";
+    if(E.loading)
+        snprintf(load, sizeof(load), "loading %d%% ", (int)((E.loadPos - E.map) * 100 / E.mapsize));
+    int len = snprintf(status, sizeof(status),"%.20s - %d lines %s%s",
             E.filename ? E.filename:"[No Name]",E.numrows,
-            E.dirty ? "(modified)" :"");
-    int rlen = snprintf(rstatus, sizeof(rstatus), "%d/%d",
-            E.cy + 1, E.numrows);
+            load, E.dirty ? "(modified)" :"");
+    char index[32] = "";
+    if(E.index) {
+        // Memory of the index, and how far it is while it is built
+        double mb = triMemory(E.index) / (1024.0 * 1024.0);
+        if(E.indexReady)
+            snprintf(index, sizeof(index), "idx %.1fMB | ", mb);
+        else
+            snprintf(index, sizeof(index), "idx %d%% %.1fMB | ",
+                     E.numrows ? (int)(E.indexNext * 100LL / E.numrows) : 0, mb);
+    }
+    char method[48] = "";
+    if(E.method != GE_OFF) snprintf(method, sizeof(method), "%s | ", geName(E.method));
+    if(E.latency && latLastClass(E.latency) >= 0) {
+        // Key to frame time of keys like the last one
+        int cls = latLastClass(E.latency);
+        long long p50 = latPercentile(E.latency, cls, 0.5);
+        long long p99 = latPercentile(E.latency, cls, 0.99);
+        if(p50 >= 0)
+            snprintf(&method[strlen(method)], sizeof(method) - strlen(method),
+                     "%s p50 %.2fms p99 %.2fms | ", latName(cls), p50 / 1e6, p99 / 1e6);
+    }
+    int rlen;
+    if(E.stats) {
+        memStats st;
+        memGetStats(&st);
+        rlen = snprintf(rstatus, sizeof(rstatus), "%s%s%d/%d | %dB/frame | %ld mallocs",
+                method, index, E.cy + 1, E.numrows, E.frameBytes, st.sysAllocs);
+    } else {
+        rlen = snprintf(rstatus, sizeof(rstatus), "%s%s%d/%d",
+                method, index, E.cy + 1, E.numrows);
+    }
     if(len > E.screencols) len = E.screencols;
     abAppend(ab, status, len);
     while(len < E.screencols) {
@@ -748,46 +2530,85 @@ void editorDrawStatusBar(struct abuf *ab) {
             abAppend(ab," ",1);
             len++;
         }
-        abAppend(ab," ",1);
-        len++;
     }
     abAppend(ab,"\x1b[m",3); // Switch to normal color
-    abAppend(ab,"\r\n",2);
 }
 
 void editorDrawMessageBar(struct abuf *ab) {
-    abAppend(ab,"\x1b[K",3); // Erase to end of line
     int msglen = strlen(E.statusmsg);
     if(msglen > E.screencols) msglen = E.screencols;
     if(msglen && time(NULL) - E.statusmsg_time < 5)
         abAppend(ab,E.statusmsg, msglen);
 }
 
+/* Make frame and shadow lines for the screen size */
+void editorInitFrame() {
+    int rows = E.screenrows + 2; // Text, status bar and message bar
+    if(E.framerows == rows) return;
+    int y;
+    for(y = 0; y < E.framerows; y++) {
+        abFree(&E.frame[y]);
+        abFree(&E.shadow[y]);
+    }
+    free(E.frame);
+    free(E.shadow);
+    E.frame = calloc(rows, sizeof(struct abuf));
+    E.shadow = calloc(rows, sizeof(struct abuf));
+    E.framerows = rows;
+    E.shadowValid = 0;
+}
+
 void editorRefreshScreen() {
     editorScroll();
+    editorInitFrame();
 
-    // Initialize append buffer
-    struct abuf ab = ABUF_INIT;
+    int y;
+    for(y = 0; y < E.framerows; y++) {
+        E.frame[y].len = 0;
+    }
+    editorDrawRows();
+    editorDrawStatusBar(&E.frame[E.screenrows]);
+    editorDrawMessageBar(&E.frame[E.screenrows + 1]);
 
-    // Write out screen
-    abAppend(&ab,"\x1b[?25l",6); /*Hide cursor*/
-    abAppend(&ab,"\x1b[H",3);/*Go home*/
+    // Append buffer is kept between refreshes
+    struct abuf *ab = &E.out;
+    ab->len = 0;
 
-    editorDrawRows(&ab);
-    editorDrawStatusBar(&ab);
-    editorDrawMessageBar(&ab);
+    // Write out screen
+    abAppend(ab,"\x1b[?25l",6); /*Hide cursor*/
 
+    // Only write lines which are different from the last frame
     char buf[32];
+    for(y = 0; y < E.framerows; y++) {
+        struct abuf *line = &E.frame[y];
+        struct abuf *old = &E.shadow[y];
+        if(E.shadowValid && line->len == old->len &&
+           (line->len == 0 || memcmp(line->b, old->b, line->len) == 0))
+            continue;
+        snprintf(buf,sizeof(buf),"\x1b[%d;1H", y + 1);
+        abAppend(ab,buf,strlen(buf));
+        abAppend(ab,line->b,line->len);
+        abAppend(ab,"\x1b[K",3);// Clear rest of the line
+    }
+
+    // This frame becomes the shadow, old shadow is reused next frame
+    struct abuf *lines = E.shadow;
+    E.shadow = E.frame;
+    E.frame = lines;
+    E.shadowValid = 1;
+
     // Expand screen area
     snprintf(buf,sizeof(buf),"\x1b[%d;%dH", (E.cy - E.rowoff) + 1,
                                             (E.rx - E.coloff) + 1);
-    abAppend(&ab,buf,strlen(buf));
+    abAppend(ab,buf,strlen(buf));
 
-    abAppend(&ab,"\x1b[?25h",6);/* Show cursor */
+    abAppend(ab,"\x1b[?25h",6);/* Show cursor */
 
     // Print out screen allocation buffer that was write
-    write(STDOUT_FILENO, ab.b, ab.len);
-    abFree(&ab);
+    write(STDOUT_FILENO, ab->b, ab->len);
+    E.frameBytes = ab->len;
+    E.totalBytes += ab->len;
+    if(E.latency) latFrame(E.latency);
 }
 
 void editorSetStatusMessage(const char *fmt, ...) {
@@ -808,13 +2629,17 @@ char *editorPrompt(char *prompt, void (*callback)(char *,int)) {
     size_t buflen = 0;
     buf[0] = '\0';
 
+    editorSetStatusMessage(prompt,buf);
     while(1) {
-        editorSetStatusMessage(prompt,buf);
-        editorRefreshScreen();
+        // Keys typed ahead are taken before drawing
+        if(!editorKeyPending()) editorRefreshScreen();
 
         int c = editorReadKey();
+        if(E.latency) latKey(E.latency, callback ? LAT_SEARCH : LAT_OTHER, E.keyTime);
         if( c == DEL_KEY || c == CTRL_KEY('h') || c == BACKSPACE ) {
-            if(buflen != 0) buf[--buflen] = '\0';
+            // Whole character, with its utf-8 continuation bytes
+            while(buflen != 0 && (buf[--buflen] & 0xC0) == 0x80);
+            buf[buflen] = '\0';
         } else if(c == '\x1b') {
             editorSetStatusMessage("");
             if(callback) {
@@ -831,16 +2656,21 @@ char *editorPrompt(char *prompt, void (*callback)(char *,int)) {
                 }
                 return buf;
             }
-        } else if (!iscntrl(c) && c < 128) {
-            if(buflen == bufsize - 1) {
+        } else if ((c < 128 && !iscntrl(c)) || (c >= 128 && c < ARROW_LEFT)) {
+            struct abuf ch = ABUF_INIT;
+            convertToUnicode(&ch, c);
+            if(buflen + ch.len >= bufsize) {
                 bufsize *= 2;
                 buf = realloc(buf,bufsize);
             }
-            buf[buflen++] = c;
+            memcpy(&buf[buflen], ch.b, ch.len);
+            buflen += ch.len;
             buf[buflen] = '\0';
+            abFree(&ch);
         }
 
-
+        // Callback may add to the prompt
+        editorSetStatusMessage(prompt,buf);
         if(callback) {
             callback(buf,c);
         }
@@ -848,21 +2678,21 @@ char *editorPrompt(char *prompt, void (*callback)(char *,int)) {
 }
 
 void editorMoveCursor(int key) {
-    erow *row = (E.cy >= E.numrows) ? NULL : &E.row[E.cy];
+    erow *row = (E.cy >= E.numrows) ? NULL : editorRow(E.cy);
 
     switch (key) {
         case ARROW_LEFT:
             // X not negative
             if(E.cx != 0) {
-                E.cx--;
+                E.cx = editorRowMoveCluster(row, E.cx, -1);
             } else if(E.cy > 0) { // Move end previous line
                 E.cy--;
-                E.cx = E.row[E.cy].size;
+                E.cx = editorRow(E.cy)->size;
             }
             break;
         case ARROW_RIGHT:
             if(row && E.cx < row->size) {
-                E.cx++;
+                E.cx = editorRowMoveCluster(row, E.cx, 1);
             } else if(row && E.cx == row->size) {// Move start next line
                 E.cy++;
                 E.cx = 0;
@@ -881,16 +2711,82 @@ void editorMoveCursor(int key) {
     }
 
     // Snap cursor to the end line
-    row = (E.cy >= E.numrows) ? NULL : &E.row[E.cy];
+    row = (E.cy >= E.numrows) ? NULL : editorRow(E.cy);
     int rowlen = row ? row->size : 0;
     if(E.cx > rowlen) {
         E.cx = rowlen;
     }
+    // Not inside a cluster after moving up or down
+    if(row) E.cx = editorRowClusterStart(row, E.cx);
+}
+
+/* Read a bracketed paste up to its end mark and insert it */
+void editorPaste() {
+    struct abuf ab = ABUF_INIT;
+    char *mark = NULL;
+    // Paste comes in many reads, end mark may be split between two
+    while(mark == NULL && editorFillInput(GHI_PASTE_WAIT_MS)) {
+        int from = ab.len > 5 ? ab.len - 5 : 0;
+        abAppend(&ab, &E.input[E.inputPos], E.inputLen - E.inputPos);
+        E.inputPos = E.inputLen;
+        if(ab.len > 0) mark = memmem(&ab.b[from], ab.len - from, "\x1b[201~", 6);
+    }
+
+    int len = ab.len;
+    if(mark) {
+        // Keys after the end mark are read again
+        len = mark - ab.b;
+        E.inputPos = 0;
+        E.inputLen = ab.len - len - 6;
+        memcpy(E.input, mark + 6, E.inputLen);
+    }
+    if(len > 0) editorInsertText(ab.b, len);
+    abFree(&ab);
+}
+/* Kind of key for the latency histograms */
+int editorKeyClass(int c) {
+    switch(c) {
+        case '\r':
+            return LAT_NEWLINE;
+        case BACKSPACE:
+        case CTRL_KEY('h'):
+        case DEL_KEY:
+            return LAT_DELETE;
+        case ARROW_UP:
+        case ARROW_DOWN:
+        case ARROW_LEFT:
+        case ARROW_RIGHT:
+        case HOME_KEY:
+        case END_KEY:
+        case PAGE_UP:
+        case PAGE_DOWN:
+            return LAT_CURSOR;
+        case CTRL_KEY('f'):
+            return LAT_SEARCH;
+        case PASTE_START:
+            return LAT_INSERT;
+    }
+    if(c == '\t' || (c >= 32 && c < ARROW_LEFT && c != BACKSPACE)) return LAT_INSERT;
+    return LAT_OTHER;
 }
+
 void editorProcessKeypress() {
     static int quit_times = GHI_QUIT_TIMES;
 
     int c = editorReadKey();
+    E.keys++;
+    int cls = editorKeyClass(c);
+    if(E.latency) latKey(E.latency, cls, E.keyTime);
+    if(E.loader && (cls == LAT_INSERT || cls == LAT_NEWLINE || cls == LAT_DELETE ||
+                    c == CTRL_KEY('s') || c == CTRL_KEY('z') || c == CTRL_KEY('y'))) {
+        // Edits, undo and save need all rows of the file, search looks
+        // at the ones loaded so far
+        editorSetStatusMessage("Loading %s, edits wait for it", E.filename);
+        editorRefreshScreen();
+        editorLoadEnd(0);
+        editorSetStatusMessage("");
+    }
+    if(E.undo) undoBegin(E.undo, E.cx, E.cy);
 
     switch(c) {
         case '\r':
@@ -904,6 +2800,7 @@ void editorProcessKeypress() {
             }
             write(STDOUT_FILENO,"\x1b[2J",4);// Clear screen
             write(STDOUT_FILENO,"\x1b[H",3);
+            editorClose();
             exit(0);
             break;
 
@@ -917,11 +2814,24 @@ void editorProcessKeypress() {
 
         case END_KEY:
             if(E.cy < E.numrows)
-                E.cx = E.row[E.cy].size;
+                E.cx = editorRow(E.cy)->size;
             break;
         case CTRL_KEY('f'):
             editorFind();
             break;
+        case PASTE_START:
+            editorPaste();
+            break;
+        case PASTE_END:
+            break;
+        case CTRL_KEY('z'):
+        case CTRL_KEY('y'):
+            editorUndo(c == CTRL_KEY('y'));
+            break;
+        case CTRL_KEY('t'):
+            E.method = (E.method + 1) % GE_METHODS;
+            editorSetStatusMessage("Vietnamese typing: %s", geName(E.method));
+            break;
         case BACKSPACE:
         case CTRL_KEY('h'):
         case DEL_KEY:
@@ -956,10 +2866,12 @@ void editorProcessKeypress() {
             /*ToDos*/
             break;
         default:
-            editorInsertChar(c); // Whenever type will be inserted
+            if(!editorEngineKey(c))
+                editorInsertChar(c); // Whenever type will be inserted
             break;
     }
 
+    if(E.undo) undoEnd(E.undo, E.cx, E.cy);
     quit_times = GHI_QUIT_TIMES;
 }
 
@@ -992,6 +2904,19 @@ void convertToUnicode(struct abuf *ab, unsigned codePoint) {
 
 
 /*** init ***/
+/* Form named by an environment variable, nfc or nfd */
+int editorNormForm(const char *name) {
+    if(name == NULL) return NORM_NONE;
+    if(!strcmp(name, "nfc")) return NORM_NFC;
+    if(!strcmp(name, "nfd")) return NORM_NFD;
+    return NORM_NONE;
+}
+
+/* Histograms go to the GHI_LATENCY file when ghi exits */
+void editorLatencyDump() {
+    latDump(E.latency, E.latencyPath);
+}
+
 void initEditor() {
     E.cx = 0;
     E.cy = 0;
@@ -999,11 +2924,55 @@ void initEditor() {
     E.rowoff = 0;
     E.coloff = 0;
     E.numrows = 0;
-    E.row = NULL;
+    E.pool = poolNew();
+    E.rows = ltNew(sizeof(erow), E.pool);
     E.dirty = 0;
     E.filename = NULL;
+    E.map = NULL;
+    E.mapsize = 0;
+    char *large = getenv("GHI_LARGE_MB");
+    E.largeBytes = (large ? strtoull(large, NULL, 10) : GHI_LARGE_MB) << 20;
+    E.large = 0;
+    E.largeRows = 0;
+    E.largeSweep = 0;
+    E.loading = E.loader = E.loadStop = 0;
+    E.loadPos = E.loadDrop = NULL;
+    char *markdown = getenv("GHI_MARKDOWN");
+    E.hlMode = markdown ? atoi(markdown) != 0 : -1;
+    E.hlClean = 0;
     E.statusmsg[0] = '\0';
     E.statusmsg_time = 0;
+    E.frame = E.shadow = NULL;
+    E.framerows = 0;
+    E.shadowValid = 0;
+    E.frameBytes = 0;
+    E.totalBytes = 0;
+    E.out.b = NULL;
+    E.out.len = E.out.cap = 0;
+    E.stats = getenv("GHI_STATS") != NULL;
+    E.nextId = 0;
+    E.index = NULL;
+    E.idRows = NULL;
+    E.idCap = 0;
+    E.indexNext = 0;
+    E.indexReady = 0;
+    E.indexStop = 0;
+    pthread_mutex_init(&E.lock, NULL);
+    pthread_mutex_init(&E.gate, NULL);
+    E.journal = NULL;
+    E.journalOn = 0;
+    E.undo = NULL;
+    char *method = getenv("GHI_INPUT");
+    E.method = method == NULL ? GE_OFF : !strcmp(method, "telex") ? GE_TELEX :
+               !strcmp(method, "vni") ? GE_VNI : GE_OFF;
+    E.inputLen = E.inputPos = 0;
+    E.normOpen = editorNormForm(getenv("GHI_NORM_OPEN"));
+    char *normSave = getenv("GHI_NORM_SAVE");
+    E.normSave = normSave ? editorNormForm(normSave) : E.normOpen;
+    E.latencyPath = getenv("GHI_LATENCY");
+    E.latency = E.latencyPath ? latNew() : NULL;
+    E.inputTime = E.keyTime = 0;
+    if(E.latency) atexit(editorLatencyDump);
 
     if(getWindowSize(&E.screenrows, &E.screencols) == -1) {
         die("getWindowSize");
@@ -1013,18 +2982,91 @@ void initEditor() {
 
 }
 
+/*** headless ***/
+
+long long editorNsSince(const struct timespec *from) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - from->tv_sec) * 1000000000LL + now.tv_nsec - from->tv_nsec;
+}
+
+long editorPeakRss() {
+    struct rusage ru;
+    return getrusage(RUSAGE_SELF, &ru) == 0 ? ru.ru_maxrss : 0;
+}
+
+/* File is open, keys come next */
+void editorHeadlessStart() {
+    // Keys of a run see the whole file, the same each time
+    editorLoadEnd(0);
+    E.openNs = editorNsSince(&E.runStart);
+    memGetStats(&E.openStats);
+    E.openRss = editorPeakRss();
+    E.keys = 0;
+    clock_gettime(CLOCK_MONOTONIC, &E.runStart);
+}
+
+/* Keys of a headless run are used up. Quit without saving and with
+ * GHI_STATS give what the run cost as one JSON line on stderr */
+void editorHeadlessEnd() {
+    long long keysNs = editorNsSince(&E.runStart);
+    memStats st;
+    memGetStats(&st);
+    editorClose();
+    if(E.stats)
+        fprintf(stderr, "{\"open_ns\": %lld, \"open_allocs\": %ld, \"open_rss_kb\": %ld, "
+                "\"keys\": %ld, \"keys_ns\": %lld, \"key_allocs\": %ld, "
+                "\"key_pool_allocs\": %ld, \"peak_rss_kb\": %ld, \"terminal_bytes\": %lld}\n",
+                E.openNs, E.openStats.sysAllocs, E.openRss, E.keys, keysNs,
+                st.sysAllocs - E.openStats.sysAllocs, st.poolAllocs - E.openStats.poolAllocs,
+                editorPeakRss(), E.totalBytes);
+    exit(0);
+}
+
+/* No key comes any more: a headless run read all of them or the
+ * terminal hung up. Edits not saved stay in the journal, the next
+ * open of the file gets them back */
+void editorInputEnd() {
+    if(E.headless) editorHeadlessEnd();
+    if(E.journal) jnSync(E.journal);
+    jnClose(E.journal, 0);
+    E.journal = NULL;
+    exit(0);
+}
+
 int main(int argc, char *argv[]) {
+    E.headless = !isatty(STDIN_FILENO);
+    clock_gettime(CLOCK_MONOTONIC, &E.runStart);
     enableRawMode();
+    // A hung up terminal ends through editorInputEnd, which keeps the journal
+    signal(SIGHUP, SIG_IGN);
     initEditor();
+    editorLock();
+    editorSetStatusMessage("HELP: Ctrl-Q = quit | Ctrl-F = find | Ctrl-Z/Y = undo/redo | Ctrl-T = telex/vni");
     if(argc >= 2) {
         editorOpen(argv[1]);
+        editorJournalRecover();
+        E.journalOn = 1;
     }
-    editorSetStatusMessage("HELP: Crl-Q = quit | Ctrl-Q = quit | Ctrl-F = find");
-
-    /* Read from stdin key */
+    // Edits recovered from the journal can not be undone
+    char *undoBytes = getenv("GHI_UNDO_BYTES");
+    E.undo = undoNew(undoBytes ? strtoul(undoBytes, NULL, 10) : GHI_UNDO_BYTES);
+    // Loader starts the index when it is done
+    if(editorIndexWanted() && !E.loading && E.index == NULL) editorIndexStart();
+    if(E.headless) editorHeadlessStart();
+
+    /* Read from stdin key, keys which came together are handled
+     * before the screen is drawn again. Scroll still follows each
+     * key as page keys move from the top of the screen */
     while(1) {
+        // Between keys nothing holds a row, far ones of a large file
+        // can go back to the map
+        if(E.large && (E.largeRows > GHI_LARGE_ROWS || E.largeSweep)) editorLargeSweep();
         editorRefreshScreen();
-        editorProcessKeypress();
+        do {
+            editorProcessKeypress();
+            editorScroll();
+        } while(editorKeyPending());
     }
 
 
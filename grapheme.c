@@ -0,0 +1,59 @@
+/* ============================================================
+   *File : grapheme.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Width and break class come from graphemetab.h, made
+   by tools/mkgrapheme.py. A code point finds its block in grStage1,
+   the block gives one byte: width | class << 2. Break rules are the
+   ones of UAX #29 for extended clusters, without CR LF as rows have
+   no line ends.
+   ============================================================ */
+#include "grapheme.h"
+
+#include "graphemetab.h"
+
+static int lookup(unsigned cp) {
+    if(cp >= 0x110000) return 1;
+    return grStage2[grStage1[cp / GR_BLOCK] * GR_BLOCK + cp % GR_BLOCK];
+}
+
+int grWidth(unsigned cp) {
+    return lookup(cp) & 3;
+}
+
+int grClassOf(unsigned cp) {
+    return lookup(cp) >> 2;
+}
+
+void grInit(grState *st) {
+    st->prev = -1;
+    st->regional = 0;
+    st->picto = 0;
+}
+
+/* Rule of UAX #29 which keeps prev and cur together, 0 for a break */
+static int joined(grState *st, int prev, int cur) {
+    if(prev == -1 || prev == GR_CONTROL || cur == GR_CONTROL) return 0;
+    if(prev == GR_L && (cur == GR_L || cur == GR_V || cur == GR_LV || cur == GR_LVT))
+        return 1;
+    if((prev == GR_LV || prev == GR_V) && (cur == GR_V || cur == GR_T)) return 1;
+    if((prev == GR_LVT || prev == GR_T) && cur == GR_T) return 1;
+    if(cur == GR_EXTEND || cur == GR_ZWJ || cur == GR_SPACING) return 1;
+    if(prev == GR_PREPEND) return 1;
+    if(prev == GR_ZWJ && cur == GR_PICTO && st->picto == 2) return 1;
+    // Flag letters pair up from the left
+    if(prev == GR_REGIONAL && cur == GR_REGIONAL) return st->regional % 2 == 1;
+    return 0;
+}
+
+int grBreak(grState *st, unsigned cp) {
+    int cur = grClassOf(cp);
+    int brk = !joined(st, st->prev, cur);
+
+    st->regional = cur == GR_REGIONAL ? st->regional + 1 : 0;
+    if(cur == GR_PICTO) st->picto = 1;
+    else if(cur == GR_ZWJ) st->picto = st->picto == 1 ? 2 : 0;
+    else if(cur != GR_EXTEND || st->picto != 1) st->picto = 0;
+    st->prev = cur;
+    return brk;
+}
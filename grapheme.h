@@ -0,0 +1,50 @@
+/* ============================================================
+   *File : grapheme.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Screen width of code points and where grapheme
+   clusters (what a user sees as one character) start
+   ============================================================ */
+#ifndef GRAPHEME_H
+#define GRAPHEME_H
+
+/* Grapheme break classes of Unicode, order is the one of the table */
+enum grClass {
+    GR_OTHER = 0,
+    GR_CONTROL,
+    GR_EXTEND,   // Combining marks like the tones of Vietnamese
+    GR_ZWJ,
+    GR_REGIONAL, // Flag letters, two make a flag
+    GR_PREPEND,
+    GR_SPACING,
+    GR_L,        // Hangul jamo and syllables
+    GR_V,
+    GR_T,
+    GR_LV,
+    GR_LVT,
+    GR_PICTO     // Emoji which can be joined by ZWJ
+};
+
+/* Where the text before the next code point stands */
+typedef struct grState grState;
+struct grState {
+    int prev;     // Class of code point before, -1 at start of text
+    int regional; // Flag letters in a row before
+    int picto;    // 1 after an emoji and its marks, 2 when a ZWJ follows them
+};
+
+/* Columns taken on a terminal by cp: 0 for combining marks, 2 for
+ * wide ones like CJK and most emoji, 1 for the rest */
+int grWidth(unsigned cp);
+
+/* enum grClass of cp */
+int grClassOf(unsigned cp);
+
+/* Start at the beginning of a text */
+void grInit(grState *st);
+
+/* Give the next code point of the text, return 1 when a cluster
+ * starts at it */
+int grBreak(grState *st, unsigned cp);
+
+#endif // End GRAPHEME_H
@@ -0,0 +1,1448 @@
+/* Made by tools/mkgrapheme.py from Unicode 14.0.0, do not edit */
+#define GR_BLOCK 128
+
+static const unsigned char grStage1[8704] = {
+    0,1,2,2,2,2,3,4,2,5,6,7,8,9,10,11,
+    12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,
+    28,29,30,31,32,33,34,35,2,2,2,2,2,36,37,38,
+    39,40,41,42,43,44,45,46,47,48,2,49,2,2,50,51,
+    52,53,54,55,2,2,56,57,58,59,2,60,61,62,63,64,
+    2,2,65,2,2,2,66,67,2,68,69,70,71,72,72,72,
+    73,74,72,72,75,76,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,77,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,78,2,2,79,80,2,81,
+    82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,90,
+    91,92,93,94,95,96,90,91,92,93,94,95,96,90,91,92,
+    93,94,95,96,90,91,92,93,94,95,96,90,91,92,93,94,
+    95,96,90,91,92,93,94,95,96,90,91,92,93,94,95,96,
+    90,91,92,93,94,95,96,90,91,92,93,94,95,96,90,91,
+    92,93,94,95,96,90,91,92,93,94,95,96,90,91,92,97,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,72,72,72,72,98,99,2,2,2,100,101,102,103,104,
+    105,106,107,108,72,109,110,111,2,112,113,114,2,2,115,116,
+    117,118,119,120,121,122,123,124,125,126,127,72,128,129,130,131,
+    132,133,134,135,136,137,138,72,139,140,72,141,142,143,144,72,
+    145,146,147,148,149,150,72,72,151,152,153,154,72,155,72,156,
+    2,2,2,2,2,2,2,157,158,2,159,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,160,
+    2,2,2,2,2,2,2,2,161,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,2,2,2,2,162,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    2,2,2,2,163,164,165,166,72,72,72,72,77,167,168,169,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,170,171,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,172,159,
+    2,173,174,175,176,177,178,72,179,180,181,2,2,182,2,183,
+    2,2,2,2,184,185,72,72,72,72,72,72,72,72,186,72,
+    187,72,188,72,72,189,72,72,72,72,72,72,72,72,72,190,
+    2,191,192,72,72,72,72,72,193,194,195,72,196,197,72,72,
+    198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,
+    214,215,216,203,217,203,2,218,203,203,203,203,203,203,203,219,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    220,72,221,222,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,223,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,223,
+};
+
+static const unsigned char grStage2[28672] = {
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    1,1,1,1,1,1,1,1,1,49,1,1,1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,
+    2,2,2,2,1,1,1,1,1,1,1,2,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,1,8,
+    1,8,8,1,8,8,1,8,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    20,20,20,20,20,20,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,1,4,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,20,1,8,
+    8,8,8,8,8,1,1,8,8,1,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,20,1,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,2,2,8,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,1,8,8,8,8,8,
+    8,8,8,8,1,8,8,8,1,8,8,8,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,2,2,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,20,20,2,2,2,2,2,2,8,8,8,8,8,8,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,20,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,25,8,1,25,25,
+    25,8,8,8,8,8,8,8,8,25,25,25,25,8,25,25,1,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,
+    1,1,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,8,25,25,2,1,1,1,1,1,1,1,1,2,2,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,2,2,2,1,1,1,1,2,2,8,1,25,25,
+    25,8,8,8,8,2,2,25,25,2,2,25,25,8,1,2,2,2,2,2,2,2,2,25,2,2,2,2,1,1,2,1,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,2,
+    2,8,8,25,2,1,1,1,1,1,1,2,2,2,2,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,1,1,2,1,1,2,2,8,2,25,25,
+    25,8,8,2,2,2,2,8,8,2,2,8,8,8,2,2,2,8,2,2,2,2,2,2,2,1,1,1,1,2,1,2,
+    2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,8,8,1,1,1,8,1,2,2,2,2,2,2,2,2,2,
+    2,8,8,25,2,1,1,1,1,1,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,2,2,8,1,25,25,
+    25,8,8,8,8,8,2,8,8,25,2,25,25,8,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,8,8,8,8,8,8,
+    2,8,25,25,2,1,1,1,1,1,1,1,1,2,2,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,2,2,8,1,25,8,
+    25,8,8,8,8,2,2,25,25,2,2,25,25,8,2,2,2,2,2,2,2,8,8,25,2,2,2,2,1,1,2,1,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+    2,2,8,1,2,1,1,1,1,1,1,2,2,2,1,1,1,2,1,1,1,1,2,2,2,1,1,2,1,2,1,1,
+    2,2,2,1,1,2,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,25,25,
+    8,25,25,2,2,2,25,25,25,2,25,25,25,8,2,2,1,2,2,2,2,2,2,25,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+    8,25,25,25,8,1,1,1,1,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,1,8,8,
+    8,25,25,25,25,2,8,8,8,2,8,8,8,8,2,2,2,2,2,2,2,8,8,2,1,1,1,2,2,1,2,2,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+    1,8,25,25,1,1,1,1,1,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,2,2,8,1,25,8,
+    25,25,25,25,25,2,8,25,25,2,25,25,8,8,2,2,2,2,2,2,2,25,25,2,2,2,2,2,2,1,1,2,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,25,25,1,1,1,1,1,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,1,25,25,
+    25,8,8,8,8,2,25,25,25,2,25,25,25,8,21,1,2,2,2,2,1,1,1,25,1,1,1,1,1,1,1,1,
+    1,1,8,8,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,8,25,25,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,1,2,2,
+    1,1,1,1,1,1,1,2,2,2,8,2,2,2,2,25,25,25,8,8,8,2,8,2,25,25,25,25,25,25,25,25,
+    2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,25,25,1,2,2,2,2,2,2,2,2,2,2,2,
+    2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,1,8,8,8,8,8,8,8,2,2,2,2,1,
+    1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,1,1,2,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,1,2,1,1,1,1,1,1,1,1,1,1,8,1,1,8,8,8,8,8,8,8,8,8,1,2,2,
+    1,1,1,1,1,2,1,2,8,8,8,8,8,8,2,2,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,8,1,8,1,1,1,1,25,25,
+    1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,25,
+    8,8,8,8,8,1,8,8,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,2,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,1,1,
+    1,1,1,1,1,1,8,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,25,25,8,8,8,8,25,8,8,8,8,8,8,25,8,8,25,25,8,8,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,8,8,1,1,1,1,8,8,
+    8,1,25,25,25,1,1,25,25,25,25,25,25,25,1,1,1,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,8,25,25,8,8,25,25,25,25,25,25,8,1,25,1,1,1,1,1,1,1,1,1,1,25,25,25,8,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,1,2,2,2,2,2,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+    30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+    30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,2,1,2,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,2,
+    1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,25,2,2,2,2,2,2,2,2,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,25,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,2,8,8,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,25,8,8,8,8,8,8,8,25,25,
+    25,25,25,25,25,25,8,25,25,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,8,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,8,8,8,4,8,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,8,1,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    8,8,8,25,25,25,25,8,8,25,25,25,2,2,2,2,25,25,8,25,25,25,25,25,25,8,8,8,2,2,2,2,
+    1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,25,25,8,2,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,8,25,8,8,8,8,8,8,8,2,
+    8,25,8,25,25,8,8,8,8,8,8,8,8,25,25,25,25,25,25,8,8,8,8,8,8,8,8,8,8,2,2,8,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,25,8,8,8,8,8,25,8,25,25,25,
+    25,25,8,25,25,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,2,
+    8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,25,8,8,8,8,25,25,8,8,25,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,8,25,8,8,25,25,25,8,25,8,8,8,25,25,2,2,2,2,2,2,2,2,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,25,25,25,25,25,25,25,25,8,8,8,8,8,8,8,8,25,25,8,8,2,2,2,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,8,8,8,1,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,25,8,8,8,8,8,8,8,1,1,1,1,8,1,1,1,1,1,1,8,1,1,25,8,8,1,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,2,1,2,1,2,1,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,2,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,4,8,12,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,5,5,4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,49,1,1,1,
+    1,1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    4,4,4,4,4,2,4,4,4,4,4,4,4,4,4,4,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,49,49,49,49,49,49,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,49,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,50,1,1,1,1,
+    1,1,1,1,1,1,1,1,49,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,50,50,50,50,49,49,49,50,49,49,50,1,1,1,1,49,49,49,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,49,49,1,1,1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,1,1,1,
+    49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,49,50,50,1,
+    49,49,49,49,49,49,1,49,49,49,49,49,49,49,49,49,49,49,49,1,50,50,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,50,50,50,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,
+    49,49,49,49,49,49,1,1,1,1,1,1,1,1,1,1,49,49,49,50,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,50,49,49,49,49,49,49,49,49,50,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,49,
+    49,49,49,49,50,50,49,49,49,49,49,49,49,49,50,49,49,49,49,49,50,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,50,49,49,49,49,49,49,49,50,50,49,50,49,49,49,49,50,49,49,50,49,49,
+    49,49,49,49,49,50,1,1,49,49,50,50,49,49,49,49,49,49,49,1,49,1,49,1,1,1,1,1,1,49,1,1,
+    1,49,1,1,1,1,1,1,50,1,1,1,1,1,1,1,1,1,1,49,49,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,49,1,1,49,1,1,1,1,50,1,50,1,1,1,1,50,50,50,1,50,1,1,1,1,1,1,1,1,
+    1,1,1,49,49,49,49,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,50,50,1,1,1,1,1,1,1,1,
+    1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,49,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,49,49,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,50,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,1,1,1,1,50,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,1,1,2,2,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,1,2,2,2,2,2,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,8,8,8,8,26,26,50,2,2,2,2,2,2,2,2,2,2,2,2,50,2,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,8,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,50,2,50,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,1,8,8,8,8,8,8,8,8,8,8,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,2,1,2,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,8,1,1,1,8,1,1,1,1,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,25,25,8,8,25,1,1,1,1,8,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+    25,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,8,8,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,8,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,25,25,2,2,2,2,2,2,2,2,2,2,2,1,
+    30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,2,2,2,
+    8,8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,25,25,8,8,8,8,25,25,8,8,25,25,
+    25,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,
+    1,1,1,1,1,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,25,25,8,8,25,25,8,8,2,2,2,2,2,2,2,2,2,
+    1,1,1,8,1,1,1,1,1,1,1,1,8,25,2,2,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,8,25,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,8,8,8,1,1,8,8,1,1,1,1,1,8,8,
+    1,8,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,25,8,8,25,25,1,1,1,1,1,25,8,2,2,2,2,2,2,2,2,2,
+    2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,25,25,8,25,25,8,25,25,1,25,8,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,46,46,46,46,42,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+    46,46,46,46,2,2,2,2,2,2,2,2,2,2,2,2,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,0,0,0,0,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,0,0,0,0,
+    1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,2,2,2,2,2,1,8,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,2,1,2,
+    1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,4,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,9,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,2,2,1,1,1,2,2,2,
+    2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,4,4,4,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+    1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,
+    1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,2,2,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,2,2,1,2,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,2,2,2,2,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,8,8,8,2,8,8,2,2,2,2,2,8,8,8,8,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,2,2,2,2,8,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,8,8,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,2,2,2,
+    2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,8,8,8,8,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,2,8,8,1,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,8,8,8,8,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    25,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,1,8,8,1,2,2,2,2,2,2,2,2,2,8,
+    8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,25,25,8,8,1,1,20,1,1,
+    1,1,8,2,2,2,2,2,2,2,2,2,2,20,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,8,8,8,8,8,25,8,8,8,8,8,8,8,8,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,25,25,1,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,1,1,1,2,2,2,2,2,2,2,2,2,
+    8,8,25,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,8,8,8,8,8,25,
+    25,1,21,21,1,1,1,1,1,8,8,8,8,1,25,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,25,25,8,25,8,8,1,1,1,1,1,1,8,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,2,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,
+    25,25,25,8,8,8,8,8,8,8,8,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    8,8,25,25,2,1,1,1,1,1,1,1,1,2,2,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,2,8,8,1,25,25,
+    8,25,25,25,25,2,2,25,25,2,2,25,25,25,2,2,1,2,2,2,2,2,2,25,2,2,2,2,2,1,1,1,
+    1,1,25,25,2,2,8,8,8,8,8,8,8,2,2,2,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,8,8,8,8,
+    25,25,8,8,8,25,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,8,1,
+    1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,8,8,25,8,25,25,25,25,8,
+    8,25,8,8,1,1,1,1,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,2,2,25,25,25,25,8,8,25,8,
+    8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,8,8,8,8,25,25,8,25,8,
+    8,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,8,25,8,25,25,8,8,8,8,8,8,25,8,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,
+    25,25,8,8,8,8,25,8,8,8,8,8,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,8,8,8,8,8,25,8,8,1,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,1,
+    1,1,1,1,1,1,1,2,2,1,2,2,1,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,25,25,25,2,25,25,2,2,8,8,25,8,21,
+    25,21,25,8,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,25,25,8,8,8,8,2,2,8,8,25,25,25,25,
+    8,1,1,1,25,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,25,21,8,8,8,8,1,
+    1,1,1,1,1,1,1,8,2,2,2,2,2,2,2,2,1,8,8,8,8,8,8,25,25,8,8,8,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,21,21,21,21,21,21,8,8,8,8,8,8,8,8,8,8,8,8,8,25,8,8,1,1,1,1,1,1,
+    1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,25,8,8,8,8,8,8,8,2,8,8,8,8,8,8,25,8,
+    1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,2,25,8,8,8,8,8,8,8,25,8,8,25,8,8,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,2,2,2,8,2,8,8,2,8,
+    8,8,8,8,8,8,21,8,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,25,25,25,25,25,2,8,8,2,25,25,8,25,8,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,25,25,1,1,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,4,4,4,4,4,4,4,4,4,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,8,8,8,8,8,1,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,
+    1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,8,1,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,2,2,2,2,2,2,2,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,8,2,2,2,2,2,2,2,2,2,2,2,26,26,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+    1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,1,8,8,1,
+    4,4,4,4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,25,25,8,8,8,1,1,1,25,25,25,25,25,25,4,4,4,4,4,4,4,4,8,8,8,8,8,
+    8,8,8,1,1,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,8,8,8,8,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,8,8,8,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,
+    2,2,1,2,2,1,1,2,2,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,2,1,2,1,1,1,
+    1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,
+    1,1,1,1,1,2,1,2,2,2,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,1,1,1,1,1,1,1,1,8,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,8,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,8,8,8,8,
+    2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,8,8,8,8,8,2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,8,8,8,8,8,
+    8,8,2,8,8,2,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,8,8,8,8,8,8,8,1,1,1,1,1,1,1,2,2,
+    1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,8,8,8,8,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,2,1,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,8,8,8,8,8,8,8,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,1,1,2,1,2,2,1,2,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,2,1,2,1,2,2,2,2,
+    2,2,1,2,2,2,2,1,2,1,2,1,2,1,1,1,2,1,1,2,1,2,2,1,2,1,2,1,2,1,2,1,
+    2,1,1,2,1,2,2,1,1,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,2,1,1,1,1,2,1,2,
+    1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+    2,1,1,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    49,49,49,49,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,50,50,50,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,49,49,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,49,49,49,49,49,49,1,1,1,1,1,1,1,1,1,1,1,1,49,49,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,1,1,50,50,50,50,50,50,50,50,50,50,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,49,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+    2,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,2,2,2,2,2,2,2,2,2,2,50,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,50,2,2,50,50,50,50,50,50,50,50,50,2,50,50,50,50,
+    2,2,2,2,2,2,2,2,2,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,49,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,49,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,49,49,49,49,49,49,49,49,49,49,49,49,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,49,49,49,49,50,50,50,50,50,49,49,49,49,49,49,49,49,49,49,49,49,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,49,49,49,50,49,49,49,50,50,50,10,10,10,10,10,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,49,
+    50,49,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,49,49,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,1,1,
+    1,1,1,1,1,1,49,49,49,49,49,50,50,50,50,49,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,50,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,49,49,49,49,49,49,50,49,49,49,50,50,50,49,49,50,50,50,50,50,50,50,50,50,50,50,
+    49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,49,49,49,49,50,50,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,50,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,49,49,49,49,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,50,50,50,50,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,50,50,50,50,50,50,50,50,1,1,1,1,1,1,1,1,1,1,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,50,50,50,50,50,50,50,50,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,50,50,49,49,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,1,50,50,50,50,
+    50,50,50,50,50,50,1,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,50,50,50,
+    49,49,49,49,49,49,49,49,49,49,49,49,49,49,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,2,2,
+    2,4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
+};
@@ -0,0 +1,313 @@
+/* ============================================================
+   *File : journal.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Journal file is a header then records:
+
+       "GHJ2" [size][mtime sec][mtime nsec]         8 bytes little endian
+       [op][row][col][value][len][bytes ...][crc]   op is 1 byte, numbers
+       [op][row][col][value][len][bytes ...][crc]   are zigzag varints
+
+   Crc is the CRC-32 of the record before it, 4 bytes little endian.
+   A crash during a sync may leave a torn or garbage record at the end,
+   replay stops at the first record whose crc does not match and cuts
+   the file there, so records added after recovery follow good ones.
+
+   Records are added to a memory buffer. A thread swaps it with a
+   second buffer every syncMs, writes it and calls fdatasync, so a key
+   press never waits for the disk and many records share one sync.
+   ============================================================ */
+#define _POSIX_C_SOURCE 200809L
+#include "journal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define JN_MAGIC "GHJ2" // GHIJ journals had no crc, they are not read
+#define JN_HEADER_SIZE 28
+#define JN_MAX_VARINT 10
+#define JN_CRC_SIZE 4
+
+struct journal {
+    int fd;
+    char *path;
+    int syncMs;
+    pthread_mutex_t lock;      // Guards buf and stop
+    pthread_mutex_t writeLock; // Keeps writes in order
+    pthread_cond_t wake;
+    pthread_t thread;
+    int stop;
+    char *buf;   // Records added since the last write
+    size_t len;
+    size_t cap;
+    char *out;   // Records being written
+    size_t outCap;
+};
+
+static void put64(unsigned char *p, long long v) {
+    unsigned long long u = v;
+    for(int i = 0; i < 8; i++)
+        p[i] = u >> (8 * i);
+}
+
+static void makeHeader(unsigned char *h, const jnStamp *stamp) {
+    memcpy(h, JN_MAGIC, 4);
+    put64(&h[4], stamp->size);
+    put64(&h[12], stamp->mtimeSec);
+    put64(&h[20], stamp->mtimeNsec);
+}
+
+/* CRC-32 (the one of zlib) four bits at a time */
+static unsigned crc32(const unsigned char *p, size_t len) {
+    static const unsigned nibble[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    unsigned crc = 0xFFFFFFFF;
+    for(size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        crc = (crc >> 4) ^ nibble[crc & 15];
+        crc = (crc >> 4) ^ nibble[crc & 15];
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+static size_t putVarint(char *p, long v) {
+    unsigned long u = v < 0 ? ((unsigned long)-(v + 1) << 1) | 1 : (unsigned long)v << 1;
+    size_t n = 0;
+    while(u >= 0x80) {
+        p[n++] = (u & 0x7F) | 0x80;
+        u >>= 7;
+    }
+    p[n++] = u;
+    return n;
+}
+
+/* Read a varint at *p, 0 when it runs past end */
+static int getVarint(const unsigned char **p, const unsigned char *end, long *v) {
+    unsigned long u = 0;
+    int shift = 0;
+    while(*p < end && shift < 7 * JN_MAX_VARINT) {
+        unsigned char c = *(*p)++;
+        u |= (unsigned long)(c & 0x7F) << shift;
+        shift += 7;
+        if(!(c & 0x80)) {
+            *v = u & 1 ? -(long)(u >> 1) - 1 : (long)(u >> 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int writeAll(int fd, const char *s, size_t len) {
+    while(len > 0) {
+        ssize_t n = write(fd, s, len);
+        if(n == -1) {
+            if(errno == EINTR) continue;
+            return -1;
+        }
+        s += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* Write out what was added so far */
+static void flush(journal *j) {
+    pthread_mutex_lock(&j->writeLock);
+    pthread_mutex_lock(&j->lock);
+    char *out = j->buf;
+    size_t len = j->len;
+    j->buf = j->out;
+    j->len = 0;
+    size_t cap = j->cap;
+    j->cap = j->outCap;
+    j->out = out;
+    j->outCap = cap;
+    pthread_mutex_unlock(&j->lock);
+
+    if(len > 0 && writeAll(j->fd, out, len) == 0)
+        fdatasync(j->fd);
+    pthread_mutex_unlock(&j->writeLock);
+}
+
+static void *flusher(void *arg) {
+    journal *j = arg;
+    pthread_mutex_lock(&j->lock);
+    while(!j->stop) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += j->syncMs / 1000;
+        ts.tv_nsec += (long)(j->syncMs % 1000) * 1000000;
+        if(ts.tv_nsec >= 1000000000) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(&j->wake, &j->lock, &ts);
+        if(j->len == 0) continue;
+        pthread_mutex_unlock(&j->lock);
+        flush(j);
+        pthread_mutex_lock(&j->lock);
+    }
+    pthread_mutex_unlock(&j->lock);
+    flush(j);
+    return NULL;
+}
+
+journal *jnOpen(const char *path, const jnStamp *stamp, int keep, int syncMs) {
+    int fd = -1;
+    if(keep)
+        fd = open(path, O_WRONLY | O_APPEND);
+    if(fd == -1) {
+        unsigned char h[JN_HEADER_SIZE];
+        fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0600);
+        if(fd == -1) return NULL;
+        makeHeader(h, stamp);
+        if(writeAll(fd, (char *)h, sizeof(h)) == -1) {
+            close(fd);
+            unlink(path);
+            return NULL;
+        }
+        fdatasync(fd);
+    }
+
+    journal *j = calloc(1, sizeof(journal));
+    if(j == NULL) {
+        close(fd);
+        return NULL;
+    }
+    j->fd = fd;
+    j->path = strdup(path);
+    j->syncMs = syncMs;
+    pthread_mutex_init(&j->lock, NULL);
+    pthread_mutex_init(&j->writeLock, NULL);
+    pthread_cond_init(&j->wake, NULL);
+    if(pthread_create(&j->thread, NULL, flusher, j) != 0) {
+        close(fd);
+        free(j->path);
+        free(j);
+        return NULL;
+    }
+    return j;
+}
+
+void jnAdd(journal *j, const jnRecord *r) {
+    pthread_mutex_lock(&j->lock);
+    size_t need = j->len + 1 + 4 * JN_MAX_VARINT + r->len + JN_CRC_SIZE;
+    if(need > j->cap) {
+        size_t cap = j->cap ? j->cap * 2 : 4096;
+        while(cap < need) cap *= 2;
+        char *buf = realloc(j->buf, cap);
+        if(buf == NULL) {
+            pthread_mutex_unlock(&j->lock);
+            return;
+        }
+        j->buf = buf;
+        j->cap = cap;
+    }
+    char *start = &j->buf[j->len];
+    char *p = start;
+    *p++ = r->op;
+    p += putVarint(p, r->row);
+    p += putVarint(p, r->col);
+    p += putVarint(p, r->value);
+    p += putVarint(p, r->len);
+    if(r->len) memcpy(p, r->bytes, r->len);
+    p += r->len;
+    unsigned crc = crc32((unsigned char *)start, p - start);
+    for(int i = 0; i < JN_CRC_SIZE; i++)
+        *p++ = crc >> (8 * i);
+    j->len = p - j->buf;
+    pthread_mutex_unlock(&j->lock);
+}
+
+void jnSync(journal *j) {
+    flush(j);
+}
+
+void jnClose(journal *j, int remove) {
+    if(j == NULL) return;
+    pthread_mutex_lock(&j->lock);
+    j->stop = 1;
+    pthread_cond_signal(&j->wake);
+    pthread_mutex_unlock(&j->lock);
+    pthread_join(j->thread, NULL);
+
+    close(j->fd);
+    if(remove) unlink(j->path);
+    pthread_mutex_destroy(&j->lock);
+    pthread_mutex_destroy(&j->writeLock);
+    pthread_cond_destroy(&j->wake);
+    free(j->buf);
+    free(j->out);
+    free(j->path);
+    free(j);
+}
+
+long jnReplay(const char *path, const jnStamp *stamp,
+              void (*fn)(void *ctx, const jnRecord *r), void *ctx) {
+    // Written too, a bad end is cut off
+    int fd = open(path, O_RDWR);
+    if(fd == -1) fd = open(path, O_RDONLY);
+    if(fd == -1) return -1;
+    struct stat st;
+    if(fstat(fd, &st) == -1 || st.st_size < JN_HEADER_SIZE) {
+        close(fd);
+        return -1;
+    }
+
+    unsigned char *data = malloc(st.st_size);
+    size_t size = 0;
+    while(data && size < (size_t)st.st_size) {
+        ssize_t n = read(fd, &data[size], st.st_size - size);
+        if(n <= 0) break;
+        size += n;
+    }
+
+    unsigned char h[JN_HEADER_SIZE];
+    makeHeader(h, stamp);
+    if(data == NULL || size < JN_HEADER_SIZE || memcmp(data, h, JN_HEADER_SIZE) != 0) {
+        close(fd);
+        free(data);
+        return -1;
+    }
+
+    long count = 0;
+    const unsigned char *p = &data[JN_HEADER_SIZE];
+    const unsigned char *end = &data[size];
+    while(p < end) {
+        jnRecord r;
+        long len;
+        const unsigned char *start = p;
+        r.op = *p++;
+        if(!getVarint(&p, end, &r.row) || !getVarint(&p, end, &r.col) ||
+           !getVarint(&p, end, &r.value) || !getVarint(&p, end, &len) ||
+           len < 0 || len > end - p - JN_CRC_SIZE) {
+            p = start;
+            break;
+        }
+        r.bytes = (const char *)p;
+        r.len = len;
+        p += len;
+        unsigned crc = 0;
+        for(int i = 0; i < JN_CRC_SIZE; i++)
+            crc |= (unsigned)p[i] << (8 * i);
+        if(crc != crc32(start, p - start)) {
+            p = start;
+            break;
+        }
+        p += JN_CRC_SIZE;
+        fn(ctx, &r);
+        count++;
+    }
+    if(p < end && ftruncate(fd, p - data) == 0) fdatasync(fd);
+    close(fd);
+    free(data);
+    return count;
+}
@@ -0,0 +1,55 @@
+/* ============================================================
+   *File : journal.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Append only file of edit records, synced to disk
+   in groups by a background thread
+   ============================================================ */
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stddef.h>
+
+typedef struct journal journal;
+
+/* Version of the file a journal belongs to */
+typedef struct jnStamp jnStamp;
+struct jnStamp {
+    long long size;
+    long long mtimeSec;
+    long long mtimeNsec;
+};
+
+/* One edit, meaning of the fields is up to the caller */
+typedef struct jnRecord jnRecord;
+struct jnRecord {
+    int op;
+    long row;
+    long col;
+    long value;
+    const char *bytes;
+    size_t len;
+};
+
+/* Start a journal at path for the file version stamp. With keep an
+ * existing journal is continued, otherwise it is replaced. Records
+ * reach the disk every syncMs milliseconds */
+journal *jnOpen(const char *path, const jnStamp *stamp, int keep, int syncMs);
+
+/* Add a record, it is only copied to memory here */
+void jnAdd(journal *j, const jnRecord *r);
+
+/* Write and sync everything added so far */
+void jnSync(journal *j);
+
+/* Stop the journal, with remove its file is deleted */
+void jnClose(journal *j, int remove);
+
+/* Call fn for every record of the journal at path when it belongs to
+ * stamp. Return number of records, -1 when there is no journal for
+ * this version. Replay stops at the first record which is cut or does
+ * not match its crc, the file is cut there */
+long jnReplay(const char *path, const jnStamp *stamp,
+              void (*fn)(void *ctx, const jnRecord *r), void *ctx);
+
+#endif // End JOURNAL_H
@@ -0,0 +1,164 @@
+/* ============================================================
+   *File : latency.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Histograms like HdrHistogram: values below
+   LAT_SUB are counted one by one, above it each power of two has
+   LAT_SUB / 2 buckets, so a value is off by at most 1 / 16 (6%):
+
+       [0] [1] ... [31] | [32,33] ... [62,63] | [64..67] ... | ...
+
+   Keys wait in a short list until the frame with them is written.
+   ============================================================ */
+#define _POSIX_C_SOURCE 200809L
+#include "latency.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LAT_SUB_BITS 5
+#define LAT_SUB (1 << LAT_SUB_BITS)
+#define LAT_HALF (LAT_SUB / 2)
+#define LAT_MAX_BITS 40 // Longest time kept is 2^40 ns, about 18 minutes
+#define LAT_BUCKETS ((LAT_MAX_BITS - LAT_SUB_BITS + 1) * LAT_HALF + LAT_HALF)
+#define LAT_PENDING 256 // Keys of one frame, more are not timed
+
+typedef struct latHist {
+    long long count;
+    long long sum;
+    long long max;
+    long long buckets[LAT_BUCKETS];
+} latHist;
+
+typedef struct latPending {
+    int cls;
+    long long start;
+} latPending;
+
+struct latRecorder {
+    latHist hist[LAT_CLASSES];
+    latPending pending[LAT_PENDING];
+    int npending;
+    int last;
+};
+
+static const char *names[LAT_CLASSES] = {
+    "insert", "newline", "delete", "cursor", "search", "other"
+};
+
+static int bucketOf(long long v) {
+    if(v < LAT_SUB) return v < 0 ? 0 : (int)v;
+    if(v >= 1LL << LAT_MAX_BITS) v = (1LL << LAT_MAX_BITS) - 1;
+    int top = 63 - __builtin_clzll(v);
+    int shift = top - (LAT_SUB_BITS - 1);
+    return shift * LAT_HALF + (int)(v >> shift);
+}
+
+static long long bucketLow(int b) {
+    if(b < LAT_SUB) return b;
+    int shift = b / LAT_HALF - 1;
+    return (long long)(b - shift * LAT_HALF) << shift;
+}
+
+static long long bucketHigh(int b) {
+    if(b < LAT_SUB) return b;
+    return bucketLow(b) + (1LL << (b / LAT_HALF - 1)) - 1;
+}
+
+latRecorder *latNew(void) {
+    latRecorder *r = calloc(1, sizeof(latRecorder));
+    if(r) r->last = -1;
+    return r;
+}
+
+void latFree(latRecorder *r) {
+    free(r);
+}
+
+const char *latName(int cls) {
+    return cls >= 0 && cls < LAT_CLASSES ? names[cls] : "?";
+}
+
+long long latNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void latKey(latRecorder *r, int cls, long long start) {
+    r->last = cls;
+    if(r->npending == LAT_PENDING) return;
+    r->pending[r->npending].cls = cls;
+    r->pending[r->npending].start = start;
+    r->npending++;
+}
+
+void latFrame(latRecorder *r) {
+    if(r->npending == 0) return;
+    long long now = latNow();
+    for(int i = 0; i < r->npending; i++) {
+        latHist *h = &r->hist[r->pending[i].cls];
+        long long v = now - r->pending[i].start;
+        h->buckets[bucketOf(v)]++;
+        h->count++;
+        h->sum += v;
+        if(v > h->max) h->max = v;
+    }
+    r->npending = 0;
+}
+
+int latLastClass(latRecorder *r) {
+    return r->last;
+}
+
+/* Highest value of the bucket holding the value at p, like
+ * HdrHistogram it is not more than the largest one seen */
+static long long percentile(const latHist *h, double p) {
+    if(h->count == 0) return -1;
+    long long rank = (long long)(p * h->count + 0.5);
+    if(rank < 1) rank = 1;
+    long long seen = 0;
+    for(int b = 0; b < LAT_BUCKETS; b++) {
+        seen += h->buckets[b];
+        if(seen >= rank) {
+            long long v = bucketHigh(b);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+long long latPercentile(latRecorder *r, int cls, double p) {
+    return percentile(&r->hist[cls], p);
+}
+
+int latDump(latRecorder *r, const char *path) {
+    FILE *fp = fopen(path, "w");
+    if(fp == NULL) return -1;
+    static const double marks[] = {0.5, 0.9, 0.99, 0.999};
+    for(int c = 0; c < LAT_CLASSES; c++) {
+        const latHist *h = &r->hist[c];
+        fprintf(fp, "# %s: %lld keys", names[c], h->count);
+        if(h->count) {
+            fprintf(fp, ", mean %lld ns", h->sum / h->count);
+            for(size_t i = 0; i < sizeof(marks) / sizeof(marks[0]); i++)
+                fprintf(fp, ", p%g %lld ns", marks[i] * 100, percentile(h, marks[i]));
+            fprintf(fp, ", max %lld ns", h->max);
+        }
+        fputc('\n', fp);
+    }
+    // Every bucket with keys: class, lowest and highest ns, keys, share of keys up to it
+    fprintf(fp, "# class low_ns high_ns count cumulative\n");
+    for(int c = 0; c < LAT_CLASSES; c++) {
+        const latHist *h = &r->hist[c];
+        long long seen = 0;
+        for(int b = 0; b < LAT_BUCKETS; b++) {
+            if(h->buckets[b] == 0) continue;
+            seen += h->buckets[b];
+            fprintf(fp, "%s %lld %lld %lld %.6f\n", names[c], bucketLow(b), bucketHigh(b),
+                    h->buckets[b], (double)seen / h->count);
+        }
+    }
+    return fclose(fp) == 0 ? 0 : -1;
+}
@@ -0,0 +1,49 @@
+/* ============================================================
+   *File : latency.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Time from a key coming in to the frame showing it
+   on the terminal, kept in a histogram per kind of key
+   ============================================================ */
+#ifndef LATENCY_H
+#define LATENCY_H
+
+typedef struct latRecorder latRecorder;
+
+enum latClass {
+    LAT_INSERT = 0,
+    LAT_NEWLINE,
+    LAT_DELETE,
+    LAT_CURSOR,
+    LAT_SEARCH,
+    LAT_OTHER,
+    LAT_CLASSES
+};
+
+latRecorder *latNew(void);
+
+void latFree(latRecorder *r);
+
+const char *latName(int cls);
+
+/* Monotonic clock in nanoseconds */
+long long latNow(void);
+
+/* A key of cls which came at start was handled, it is done when the
+ * next frame is written */
+void latKey(latRecorder *r, int cls, long long start);
+
+/* Frame is on the terminal, keys handled before it are done */
+void latFrame(latRecorder *r);
+
+/* Class of the last key, -1 before the first one */
+int latLastClass(latRecorder *r);
+
+/* Latency in ns which fraction p (0 to 1) of keys of cls were under,
+ * -1 when there are none */
+long long latPercentile(latRecorder *r, int cls, double p);
+
+/* Write all histograms to path as text, -1 on error */
+int latDump(latRecorder *r, const char *path);
+
+#endif // End LATENCY_H
@@ -0,0 +1,251 @@
+/* ============================================================
+   *File : linetree.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Lines are stored in a treap (tree + heap) ordered
+   by position. Node does not store its line number, it stores the
+   number of lines in its subtree, so we can go down from the root
+   to the line at index:
+
+               [c:5]
+              /     \
+          [c:2]     [c:2]
+          /            \
+       [c:1]          [c:1]
+
+   Random priority keep the tree balanced, insert, delete and find a
+   line are O(log n). Item of a line is allocated together with its
+   node so a pointer to it stays valid until the line is deleted.
+   Nodes also point to their parent so the index of an item is found
+   by going up and adding the lines on the left. A node may hold a
+   span of many lines, counts are then lines and not nodes.
+   ============================================================ */
+#include "linetree.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct ltnode ltnode;
+struct ltnode {
+    ltnode *left;
+    ltnode *right;
+    ltnode *parent;
+    unsigned priority;
+    int lines; // Lines of this node, 1 unless it is a span
+    int count; // Lines in this subtree
+};
+
+/* Item is placed right after node, keep it aligned */
+#define NODE_SIZE ((sizeof(ltnode) + 15) & ~(size_t)15)
+#define NODE_ITEM(n) ((void *)((char *)(n) + NODE_SIZE))
+
+struct linetree {
+    ltnode *root;
+    int itemSize;
+    unsigned seed;
+    mpool *pool;
+};
+
+static int count(ltnode *n) {
+    return n ? n->count : 0;
+}
+
+static void update(ltnode *n) {
+    n->count = count(n->left) + count(n->right) + n->lines;
+    if(n->left) n->left->parent = n;
+    if(n->right) n->right->parent = n;
+}
+
+/* xorshift, good enough for priorities */
+static unsigned nextPriority(linetree *t) {
+    unsigned x = t->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    t->seed = x;
+    return x;
+}
+
+/* Split tree n into first k lines and the rest */
+static void split(ltnode *n, int k, ltnode **left, ltnode **right) {
+    if(n == NULL) {
+        *left = *right = NULL;
+        return;
+    }
+    if(count(n->left) < k) {
+        split(n->right, k - count(n->left) - n->lines, &n->right, right);
+        *left = n;
+    } else {
+        split(n->left, k, left, &n->left);
+        *right = n;
+    }
+    update(n);
+}
+
+/* Join two trees, all lines of left come before right */
+static ltnode *merge(ltnode *left, ltnode *right) {
+    if(left == NULL) return right;
+    if(right == NULL) return left;
+    if(left->priority > right->priority) {
+        left->right = merge(left->right, right);
+        update(left);
+        return left;
+    }
+    right->left = merge(left, right->left);
+    update(right);
+    return right;
+}
+
+static ltnode *insertAt(ltnode *root, int at, ltnode *node) {
+    if(root == NULL)
+        return node;
+    if(node->priority > root->priority) {
+        split(root, at, &node->left, &node->right);
+        update(node);
+        return node;
+    }
+    int leftCount = count(root->left);
+    if(at <= leftCount)
+        root->left = insertAt(root->left, at, node);
+    else
+        root->right = insertAt(root->right, at - leftCount - root->lines, node);
+    update(root);
+    return root;
+}
+
+static ltnode *deleteAt(linetree *t, ltnode *root, int at) {
+    int leftCount = count(root->left);
+    if(at >= leftCount && at < leftCount + root->lines) {
+        ltnode *n = merge(root->left, root->right);
+        poolFree(t->pool, root, NODE_SIZE + t->itemSize);
+        return n;
+    }
+    if(at < leftCount)
+        root->left = deleteAt(t, root->left, at);
+    else
+        root->right = deleteAt(t, root->right, at - leftCount - root->lines);
+    update(root);
+    return root;
+}
+
+static void freeNodes(linetree *t, ltnode *n) {
+    while(n) {
+        ltnode *right = n->right;
+        freeNodes(t, n->left);
+        poolFree(t->pool, n, NODE_SIZE + t->itemSize);
+        n = right;
+    }
+}
+
+linetree *ltNew(int itemSize, mpool *pool) {
+    linetree *t = malloc(sizeof(linetree));
+    t->root = NULL;
+    t->itemSize = itemSize;
+    t->seed = 2463534242u;
+    t->pool = pool;
+    return t;
+}
+
+void ltFree(linetree *t) {
+    if(t == NULL)
+        return;
+    // Nodes in a pool are released together with the pool
+    if(t->pool == NULL)
+        freeNodes(t, t->root);
+    free(t);
+}
+
+int ltCount(linetree *t) {
+    return count(t->root);
+}
+
+void *ltInsert(linetree *t, int at) {
+    return ltInsertSpan(t, at, 1);
+}
+
+void *ltInsertSpan(linetree *t, int at, int lines) {
+    if(at < 0 || at > count(t->root) || lines < 1)
+        return NULL;
+    ltnode *node = poolAlloc(t->pool, NODE_SIZE + t->itemSize);
+    if(node == NULL)
+        return NULL;
+    node->left = node->right = node->parent = NULL;
+    node->priority = nextPriority(t);
+    node->lines = node->count = lines;
+    memset(NODE_ITEM(node), 0, t->itemSize);
+
+    t->root = insertAt(t->root, at, node);
+    t->root->parent = NULL;
+    return NODE_ITEM(node);
+}
+
+void *ltGet(linetree *t, int at) {
+    return ltFind(t, at, NULL);
+}
+
+void *ltFind(linetree *t, int at, int *first) {
+    ltnode *n = t->root;
+    if(at < 0 || at >= count(n))
+        return NULL;
+    int skipped = 0;
+    while(n) {
+        int leftCount = count(n->left);
+        if(at >= leftCount && at < leftCount + n->lines) {
+            if(first) *first = skipped + leftCount;
+            return NODE_ITEM(n);
+        }
+        if(at < leftCount) {
+            n = n->left;
+        } else {
+            at -= leftCount + n->lines;
+            skipped += leftCount + n->lines;
+            n = n->right;
+        }
+    }
+    return NULL;
+}
+
+int ltLinesOf(linetree *t, void *item) {
+    (void)t;
+    return ((ltnode *)((char *)item - NODE_SIZE))->lines;
+}
+
+void ltSetLines(linetree *t, void *item, int lines) {
+    (void)t;
+    ltnode *n = (ltnode *)((char *)item - NODE_SIZE);
+    n->lines = lines;
+    for(; n; n = n->parent)
+        n->count = count(n->left) + count(n->right) + n->lines;
+}
+
+void *ltNext(linetree *t, void *item) {
+    (void)t;
+    ltnode *n = (ltnode *)((char *)item - NODE_SIZE);
+    if(n->right) {
+        n = n->right;
+        while(n->left) n = n->left;
+        return NODE_ITEM(n);
+    }
+    while(n->parent && n == n->parent->right)
+        n = n->parent;
+    return n->parent ? NODE_ITEM(n->parent) : NULL;
+}
+
+void ltDelete(linetree *t, int at) {
+    if(at < 0 || at >= count(t->root))
+        return;
+    t->root = deleteAt(t, t->root, at);
+    if(t->root) t->root->parent = NULL;
+}
+
+int ltIndexOf(linetree *t, void *item) {
+    (void)t;
+    ltnode *n = (ltnode *)((char *)item - NODE_SIZE);
+    int at = count(n->left);
+    while(n->parent) {
+        if(n == n->parent->right)
+            at += count(n->parent->left) + n->parent->lines;
+        n = n->parent;
+    }
+    return at;
+}
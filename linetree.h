@@ -0,0 +1,55 @@
+/* ============================================================
+   *File : linetree.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Balanced tree of lines, each node keeps the
+   number of lines in its subtree so lines are found by index. A node
+   can also stand for a span of many lines
+   ============================================================ */
+#ifndef LINETREE_H
+#define LINETREE_H
+
+#include "mem.h"
+
+typedef struct linetree linetree;
+
+/* New tree, every line stores itemSize bytes. Nodes come from pool */
+linetree *ltNew(int itemSize, mpool *pool);
+
+/* Free the tree, items must be released by the caller before.
+ * Nodes from a pool are left to be released with the pool */
+void ltFree(linetree *t);
+
+/* Number of lines */
+int ltCount(linetree *t);
+
+/* Insert a new line at index, return its zeroed item */
+void *ltInsert(linetree *t, int at);
+
+/* Insert a span of lines at index, return its zeroed item. Index must
+ * not be inside another span */
+void *ltInsertSpan(linetree *t, int at, int lines);
+
+/* Get item of line at index, NULL when out of range.
+ * Item address does not change while the line is in the tree */
+void *ltGet(linetree *t, int at);
+
+/* Same, first line of the item goes to first when it is not NULL */
+void *ltFind(linetree *t, int at, int *first);
+
+/* Lines of the item, 1 for a line */
+int ltLinesOf(linetree *t, void *item);
+
+/* Make the item hold a number of lines, lines after it move */
+void ltSetLines(linetree *t, void *item, int lines);
+
+/* Item after item, NULL at the end */
+void *ltNext(linetree *t, void *item);
+
+/* Index of the (first) line of item, item must be in the tree */
+int ltIndexOf(linetree *t, void *item);
+
+/* Delete the line or span holding index */
+void ltDelete(linetree *t, int at);
+
+#endif // End LINETREE_H
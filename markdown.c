@@ -0,0 +1,265 @@
+/* ============================================================
+   *File : markdown.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : A line is read in two steps. First its block: in a
+   fenced block the line is code or the closing fence, otherwise it
+   may open a fence, be a heading or start with quote and list
+   markers. Then inline text left to right: `code`, *emphasis*,
+   **strong**, [links](url) and <autolinks>. Inline markup does not
+   go over the end of a line, only fences do.
+
+   State is MD_START outside of blocks, in a block it is the fence
+   length << 2, with bit 1 set for a ~~~ fence.
+   ============================================================ */
+#include "markdown.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#define MD_INDENT 3 // Spaces a block marker may have before it
+#define MD_FENCE_MAX 255 // Longer fences are taken as this long
+#define MD_SCHEME_MAX 32 // Letters of the scheme of an autolink
+
+typedef struct mdOut {
+    mdSpan *spans;
+    int max;
+    int count;
+} mdOut;
+
+static void add(mdOut *o, int start, int end, int hl) {
+    if(start >= end || o->count == o->max) return;
+    o->spans[o->count].start = start;
+    o->spans[o->count].end = end;
+    o->spans[o->count].hl = hl;
+    o->count++;
+}
+
+static int isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/* Letter or digit, bytes of utf-8 characters count as letters */
+static int isWord(char c) {
+    return (unsigned char)c >= 0x80 || isalnum((unsigned char)c);
+}
+
+/* Length of the run of c at i */
+static int run(const char *s, int i, int len, char c) {
+    int n = 0;
+    while(i + n < len && s[i + n] == c) n++;
+    return n;
+}
+
+static int blankFrom(const char *s, int i, int len) {
+    while(i < len && isBlank(s[i])) i++;
+    return i == len;
+}
+
+/* State of the block a fence at i opens, 0 when there is no fence */
+static int fenceOpen(const char *s, int i, int len) {
+    if(i >= len || (s[i] != '`' && s[i] != '~')) return 0;
+    int n = run(s, i, len, s[i]);
+    if(n < 3) return 0;
+    // Info string after backticks can not have one
+    if(s[i] == '`' && memchr(&s[i + n], '`', len - i - n)) return 0;
+    if(n > MD_FENCE_MAX) n = MD_FENCE_MAX;
+    return n << 2 | (s[i] == '~' ? 2 : 0);
+}
+
+/* End of the code span opened by n backticks at i, 0 when it is not
+ * closed by as many */
+static int codeEnd(const char *s, int i, int len, int n) {
+    int j = i + n;
+    while(j < len) {
+        if(s[j] != '`') {
+            j++;
+            continue;
+        }
+        int m = run(s, j, len, '`');
+        if(m == n) return j + m;
+        j += m;
+    }
+    return 0;
+}
+
+/* End of the emphasis opened by n * or _ at i, 0 when it is not
+ * closed on the line. A closing run is as long as the opening one
+ * or longer, escapes and code spans between are skipped */
+static int emphasisEnd(const char *s, int i, int len, int n) {
+    char c = s[i];
+    if(i + n == len || isBlank(s[i + n])) return 0;
+    // No _ inside of a word, snake_case_name
+    if(c == '_' && i > 0 && isWord(s[i - 1])) return 0;
+    int want = n > 2 ? 2 : n;
+    int j = i + n;
+    while(j < len) {
+        if(s[j] == '\\') {
+            j += 2;
+            continue;
+        }
+        if(s[j] == '`') {
+            int m = run(s, j, len, '`');
+            int end = codeEnd(s, j, len, m);
+            j = end ? end : j + m;
+            continue;
+        }
+        if(s[j] != c) {
+            j++;
+            continue;
+        }
+        int m = run(s, j, len, c);
+        if(m >= want && !isBlank(s[j - 1]) &&
+           (c == '*' || j + m == len || !isWord(s[j + m])))
+            return j + (m < n ? m : n);
+        j += m;
+    }
+    return 0;
+}
+
+/* End of the brackets opened at i with the ones inside, 0 when they
+ * are not closed */
+static int bracketEnd(const char *s, int i, int len, char open, char close) {
+    int depth = 0;
+    for(int j = i; j < len; j++) {
+        if(s[j] == '\\') {
+            j++;
+        } else if(s[j] == open) {
+            depth++;
+        } else if(s[j] == close && --depth == 0) {
+            return j + 1;
+        }
+    }
+    return 0;
+}
+
+/* [text](url), [text][ref] or the same with ! for an image at i,
+ * return its end or 0 */
+static int link(mdOut *o, const char *s, int i, int len) {
+    int text = bracketEnd(s, s[i] == '!' ? i + 1 : i, len, '[', ']');
+    if(text == 0 || text == len) return 0;
+    int target = s[text] == '(' ? bracketEnd(s, text, len, '(', ')') :
+                 s[text] == '[' ? bracketEnd(s, text, len, '[', ']') : 0;
+    if(target == 0) return 0;
+    add(o, i, text, MD_LINK);
+    add(o, text, target, MD_URL);
+    return target;
+}
+
+/* End of <scheme:...> at i, 0 when it is not an autolink */
+static int autolinkEnd(const char *s, int i, int len) {
+    int j = i + 1;
+    while(j < len && j - i <= MD_SCHEME_MAX &&
+          (isalnum((unsigned char)s[j]) || s[j] == '+' || s[j] == '.' || s[j] == '-'))
+        j++;
+    if(j - i < 3 || j == len || s[j] != ':' || !isalpha((unsigned char)s[i + 1])) return 0;
+    for(j++; j < len; j++) {
+        if(s[j] == '>') return j + 1;
+        if(s[j] == '<' || (unsigned char)s[j] <= ' ') return 0;
+    }
+    return 0;
+}
+
+/* Bytes which may start inline markup */
+static const unsigned char markup[256] = {
+    ['\\'] = 1, ['`'] = 1, ['*'] = 1, ['_'] = 1, ['['] = 1, ['!'] = 1, ['<'] = 1
+};
+
+static void inlines(mdOut *o, const char *s, int i, int len) {
+    while(i < len) {
+        // Plain text goes by quickly, long lines are read on each key
+        while(i < len && !markup[(unsigned char)s[i]]) i++;
+        if(i == len) break;
+        char c = s[i];
+        int end = 0;
+        if(c == '\\') {
+            i += 2;
+            continue;
+        }
+        if(c == '`' || c == '*' || c == '_') {
+            // A run which opens nothing is skipped as a whole
+            int n = run(s, i, len, c);
+            if(c == '`') {
+                end = codeEnd(s, i, len, n);
+                add(o, i, end, MD_CODE);
+            } else {
+                end = emphasisEnd(s, i, len, n);
+                add(o, i, end, n > 1 ? MD_STRONG : MD_EMPHASIS);
+            }
+            i = end ? end : i + n;
+            continue;
+        }
+        if(c == '[' || (c == '!' && i + 1 < len && s[i + 1] == '[')) {
+            end = link(o, s, i, len);
+        } else if(c == '<') {
+            end = autolinkEnd(s, i, len);
+            add(o, i, end, MD_URL);
+        }
+        i = end ? end : i + 1;
+    }
+}
+
+/* End of the list marker at i: "- ", "* ", "+ ", "1. " or "1) ",
+ * 0 when there is none */
+static int listMarker(const char *s, int i, int len) {
+    int j = i;
+    if(j < len && (s[j] == '-' || s[j] == '*' || s[j] == '+')) {
+        j++;
+    } else {
+        while(j < len && j - i < 9 && isdigit((unsigned char)s[j])) j++;
+        if(j == i || j == len || (s[j] != '.' && s[j] != ')')) return 0;
+        j++;
+    }
+    if(j < len && !isBlank(s[j])) return 0;
+    return j;
+}
+
+/* Line outside of a fenced block, its text starts at i */
+static void block(mdOut *o, const char *s, int i, int len) {
+    // Quotes may be nested, "> > text"
+    while(i < len && s[i] == '>') {
+        int end = i + 1 < len && isBlank(s[i + 1]) ? i + 2 : i + 1;
+        add(o, i, end, MD_MARKER);
+        i = end;
+        while(i < len && i - end < MD_INDENT && s[i] == ' ') i++;
+    }
+    int h = run(s, i, len, '#');
+    if(h >= 1 && h <= 6 && (i + h == len || isBlank(s[i + h]))) {
+        add(o, i, len, MD_HEADING);
+        return;
+    }
+    int marker = listMarker(s, i, len);
+    if(marker) {
+        add(o, i, marker, MD_MARKER);
+        i = marker;
+    }
+    inlines(o, s, i, len);
+}
+
+int mdLine(int state, const char *s, int len, mdSpan *spans, int max, int *count) {
+    mdOut o = {spans, spans ? max : 0, 0};
+    int i = 0;
+    while(i < len && i < MD_INDENT && s[i] == ' ') i++;
+
+    int next = MD_START;
+    if(state != MD_START) {
+        // Block ends at a fence of its character, as long or longer
+        int n = run(s, i, len, state & 2 ? '~' : '`');
+        if(n >= state >> 2 && blankFrom(s, i + n, len)) {
+            add(&o, 0, len, MD_FENCE);
+        } else {
+            add(&o, 0, len, MD_CODE);
+            next = state;
+        }
+    } else {
+        int fence = fenceOpen(s, i, len);
+        if(fence) {
+            add(&o, 0, len, MD_FENCE);
+            next = fence;
+        } else if(spans) {
+            block(&o, s, i, len);
+        }
+    }
+    if(count) *count = o.count;
+    return next;
+}
@@ -0,0 +1,42 @@
+/* ============================================================
+   *File : markdown.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Markdown highlight of one line at a time. All a
+   line needs from the lines before it is their state, in a fenced
+   code block or not, so rows keep the state at their end and an
+   edit only makes the rows after it be looked at again
+   ============================================================ */
+#ifndef MARKDOWN_H
+#define MARKDOWN_H
+
+#define MD_START 1 // State at the top of a text, 0 is never a state
+
+enum mdHighlight {
+    MD_NORMAL = 0,
+    MD_HEADING,
+    MD_EMPHASIS,
+    MD_STRONG,
+    MD_CODE,   // Code span or line in a fenced block
+    MD_FENCE,  // Line opening or closing a fenced block
+    MD_LINK,   // [Text] of a link or image
+    MD_URL,    // (Target) of a link, <autolink>
+    MD_MARKER, // List item or quote marker
+    MD_HIGHLIGHTS
+};
+
+/* Bytes start to end of a line are shown as hl */
+typedef struct mdSpan mdSpan;
+struct mdSpan {
+    int start;
+    int end;
+    int hl;
+};
+
+/* State after line s of len bytes, which starts in state. With spans
+ * its highlight goes there, up to max spans in order, and their number
+ * to *count. Without spans only the state is worked out, which is
+ * quick for lines outside of fenced blocks */
+int mdLine(int state, const char *s, int len, mdSpan *spans, int max, int *count);
+
+#endif // End MARKDOWN_H
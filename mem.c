@@ -0,0 +1,193 @@
+/* ============================================================
+   *File : mem.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Pool allocator
+   Pool takes big slabs from system and cuts blocks from them:
+
+   slab: [next][16][16][32][64][16][.... not used yet ....]
+
+   Block size is rounded up to a size class 16, 32, 48, 64, 96, ...
+   4096, each class is a power of two or 1.5 times one.
+   A freed block goes to the free list of its class and is given
+   out again by the next allocation of that class, so editing a row
+   over and over does not go to the system allocator. Bigger blocks
+   are allocated from system and linked in the pool.
+   Blocks have no header, size is passed again when freed.
+   ============================================================ */
+#include "mem.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_CLASSES 16
+#define POOL_MAX_SIZE 4096
+#define SLAB_SIZE (64 * 1024)
+#define ALIGN(n) (((n) + 15) & ~(size_t)15)
+
+typedef struct slab slab;
+struct slab {
+    slab *next;
+};
+
+/* Header of a big block so the pool can release it */
+typedef struct bigblock bigblock;
+struct bigblock {
+    bigblock *next;
+    bigblock *previous;
+};
+
+typedef struct freeblock freeblock;
+struct freeblock {
+    freeblock *next;
+};
+
+struct mpool {
+    freeblock *freeList[POOL_CLASSES];
+    slab *slabs;
+    char *cur;   // Not used part of the last slab
+    size_t left;
+    bigblock *big;
+};
+
+static memStats stats;
+
+static const size_t classSizes[POOL_CLASSES] = {
+    16, 32, 48, 64, 96, 128, 192, 256,
+    384, 512, 768, 1024, 1536, 2048, 3072, 4096
+};
+
+static void *sysAlloc(size_t size) {
+    stats.sysAllocs++;
+    return malloc(size);
+}
+
+static void sysFree(void *ptr) {
+    if(ptr == NULL) return;
+    stats.sysFrees++;
+    free(ptr);
+}
+
+/* Index of the smallest class which holds size */
+static int sizeClass(size_t size) {
+    int c = 0;
+    while(classSizes[c] < size) c++;
+    return c;
+}
+
+static size_t classSize(int c) {
+    return classSizes[c];
+}
+
+mpool *poolNew(void) {
+    mpool *p = sysAlloc(sizeof(mpool));
+    if(p == NULL) return NULL;
+    memset(p, 0, sizeof(mpool));
+    return p;
+}
+
+void poolRelease(mpool *p) {
+    if(p == NULL) return;
+    while(p->slabs) {
+        slab *s = p->slabs;
+        p->slabs = s->next;
+        stats.slabBytes -= SLAB_SIZE;
+        sysFree(s);
+    }
+    while(p->big) {
+        bigblock *b = p->big;
+        p->big = b->next;
+        sysFree(b);
+    }
+    sysFree(p);
+}
+
+static void *bigAlloc(mpool *p, size_t size) {
+    bigblock *b = sysAlloc(ALIGN(sizeof(bigblock)) + size);
+    if(b == NULL) return NULL;
+    b->previous = NULL;
+    b->next = p->big;
+    if(p->big) p->big->previous = b;
+    p->big = b;
+    return (char *)b + ALIGN(sizeof(bigblock));
+}
+
+static void bigFree(mpool *p, void *ptr) {
+    bigblock *b = (bigblock *)((char *)ptr - ALIGN(sizeof(bigblock)));
+    if(b->previous) b->previous->next = b->next;
+    else p->big = b->next;
+    if(b->next) b->next->previous = b->previous;
+    sysFree(b);
+}
+
+void *poolAlloc(mpool *p, size_t size) {
+    if(size == 0) size = 1;
+    if(p == NULL) return sysAlloc(size);
+
+    stats.poolAllocs++;
+    if(size > POOL_MAX_SIZE) return bigAlloc(p, size);
+
+    int c = sizeClass(size);
+    if(p->freeList[c]) {
+        freeblock *f = p->freeList[c];
+        p->freeList[c] = f->next;
+        return f;
+    }
+
+    size_t n = classSize(c);
+    if(p->left < n) {
+        // Rest of the old slab is dropped, it is small
+        slab *s = sysAlloc(SLAB_SIZE);
+        if(s == NULL) return NULL;
+        s->next = p->slabs;
+        p->slabs = s;
+        p->cur = (char *)s + ALIGN(sizeof(slab));
+        p->left = SLAB_SIZE - ALIGN(sizeof(slab));
+        stats.slabBytes += SLAB_SIZE;
+    }
+    void *ptr = p->cur;
+    p->cur += n;
+    p->left -= n;
+    return ptr;
+}
+
+void poolFree(mpool *p, void *ptr, size_t size) {
+    if(ptr == NULL) return;
+    if(p == NULL) {
+        sysFree(ptr);
+        return;
+    }
+
+    stats.poolFrees++;
+    if(size == 0) size = 1;
+    if(size > POOL_MAX_SIZE) {
+        bigFree(p, ptr);
+        return;
+    }
+    int c = sizeClass(size);
+    freeblock *f = ptr;
+    f->next = p->freeList[c];
+    p->freeList[c] = f;
+}
+
+void *poolRealloc(mpool *p, void *ptr, size_t oldSize, size_t size) {
+    if(ptr == NULL) return poolAlloc(p, size);
+    if(p == NULL) {
+        stats.sysAllocs++;
+        return realloc(ptr, size);
+    }
+    // Same class, block is big enough already
+    if(oldSize <= POOL_MAX_SIZE && size <= POOL_MAX_SIZE &&
+       sizeClass(oldSize ? oldSize : 1) == sizeClass(size ? size : 1))
+        return ptr;
+
+    void *new = poolAlloc(p, size);
+    if(new == NULL) return NULL;
+    memcpy(new, ptr, oldSize < size ? oldSize : size);
+    poolFree(p, ptr, oldSize);
+    return new;
+}
+
+void memGetStats(memStats *st) {
+    *st = stats;
+}
@@ -0,0 +1,44 @@
+/* ============================================================
+   *File : mem.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Memory pool for text of a buffer. Small blocks
+   come from slabs by size class, pool is released at once when
+   the buffer is closed
+   ============================================================ */
+#ifndef MEM_H
+#define MEM_H
+
+#include <stddef.h>
+
+typedef struct mpool mpool;
+
+/* Counters of calls to the system allocator and to pools */
+typedef struct memStats {
+    long sysAllocs;  // malloc and realloc
+    long sysFrees;
+    long poolAllocs; // Blocks given out by pools
+    long poolFrees;
+    size_t slabBytes; // Bytes held in slabs
+} memStats;
+
+/* New pool */
+mpool *poolNew(void);
+
+/* Free all blocks of the pool and the pool */
+void poolRelease(mpool *p);
+
+/* Allocate size bytes. With p NULL it goes to system allocator
+ * but still counted */
+void *poolAlloc(mpool *p, size_t size);
+
+/* Resize a block allocated with oldSize bytes */
+void *poolRealloc(mpool *p, void *ptr, size_t oldSize, size_t size);
+
+/* Give back a block, size must be the one it was allocated with */
+void poolFree(mpool *p, void *ptr, size_t size);
+
+/* Get counters */
+void memGetStats(memStats *st);
+
+#endif // End MEM_H
@@ -0,0 +1,394 @@
+/* ============================================================
+   *File : search.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : SIMD kernels compare a block of text with the first
+   byte of the needle, and the block len - 1 bytes later with its
+   last byte. Only positions where both agree are checked with memcmp
+   (Wojciech Mula, "SIMD-friendly algorithms for substring
+   searching"). Short text and the tail after the last block use
+   Horspool.
+   A utf-8 needle matched on utf-8 text always starts on a character
+   so no decoding is needed.
+   Big searches run on one worker per CPU. Items are cut in chunks
+   ordered by distance from the start, so the nearest hit is known as
+   soon as the chunks before it are done and later chunks are skipped.
+   Every start or cancel bumps a generation number and workers drop
+   a chunk when the number they took it with is old.
+   ============================================================ */
+#define _POSIX_C_SOURCE 200809L
+#include "search.h"
+#include "utf8.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+#define SPLIT_BUF_SIZE 256 // Window around the gap, on the stack
+#define SEARCH_CHUNK 2048  // Items a worker takes at once
+#define SEARCH_CHECK 256   // Items between two looks for cancel
+#define SEARCH_MAX_THREADS 64
+
+typedef long (*findFunc)(const searchPattern *p, const char *s, size_t len);
+
+static int kernel = -1;
+static findFunc find;
+
+void searchCompile(searchPattern *p, const char *needle, size_t len) {
+    p->needle = needle;
+    p->len = len;
+    for(int i = 0; i < 256; i++)
+        p->skip[i] = len;
+    for(size_t j = 0; j + 1 < len; j++)
+        p->skip[(unsigned char)needle[j]] = len - 1 - j;
+}
+
+/*** scalar ***/
+
+static long findHorspool(const searchPattern *p, const char *s, size_t len) {
+    size_t n = p->len;
+    if(n > len) return -1;
+
+    unsigned char lastByte = p->needle[n - 1];
+    size_t i = 0;
+    while(i <= len - n) {
+        unsigned char c = s[i + n - 1];
+        if(c == lastByte && memcmp(&s[i], p->needle, n - 1) == 0)
+            return i;
+        i += p->skip[c];
+    }
+    return -1;
+}
+
+#ifdef SEARCH_X86
+
+/*** SSE2 ***/
+
+__attribute__((target("sse2")))
+static long findSse2(const searchPattern *p, const char *s, size_t len) {
+    size_t n = p->len;
+    const __m128i first = _mm_set1_epi8(p->needle[0]);
+    const __m128i last = _mm_set1_epi8(p->needle[n - 1]);
+    size_t i = 0;
+    for(; i + n - 1 + 16 <= len; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)&s[i]);
+        __m128i b = _mm_loadu_si128((const __m128i *)&s[i + n - 1]);
+        unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first),
+                                                        _mm_cmpeq_epi8(b, last)));
+        while(mask) {
+            int bit = __builtin_ctz(mask);
+            if(n <= 2 || memcmp(&s[i + bit + 1], &p->needle[1], n - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    long r = findHorspool(p, &s[i], len - i);
+    return r < 0 ? -1 : (long)i + r;
+}
+
+/*** AVX2 ***/
+
+__attribute__((target("avx2")))
+static long findAvx2(const searchPattern *p, const char *s, size_t len) {
+    size_t n = p->len;
+    const __m256i first = _mm256_set1_epi8(p->needle[0]);
+    const __m256i last = _mm256_set1_epi8(p->needle[n - 1]);
+    size_t i = 0;
+    for(; i + n - 1 + 32 <= len; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)&s[i]);
+        __m256i b = _mm256_loadu_si256((const __m256i *)&s[i + n - 1]);
+        unsigned mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first),
+                                                              _mm256_cmpeq_epi8(b, last)));
+        while(mask) {
+            int bit = __builtin_ctz(mask);
+            if(n <= 2 || memcmp(&s[i + bit + 1], &p->needle[1], n - 2) == 0)
+                return i + bit;
+            mask &= mask - 1;
+        }
+    }
+    long r = findHorspool(p, &s[i], len - i);
+    return r < 0 ? -1 : (long)i + r;
+}
+
+#endif // SEARCH_X86
+
+int searchSetKernel(int k) {
+    switch(k) {
+        case UTF8_SCALAR:
+            find = findHorspool;
+            break;
+#ifdef SEARCH_X86
+        case UTF8_SSE2:
+            if(!__builtin_cpu_supports("sse2")) return 0;
+            find = findSse2;
+            break;
+        case UTF8_AVX2:
+            if(!__builtin_cpu_supports("avx2")) return 0;
+            find = findAvx2;
+            break;
+#endif
+        default:
+            return 0;
+    }
+    kernel = k;
+    return 1;
+}
+
+/* Pick the best kernel, unless one was set before */
+static void pick(void) {
+    if(kernel >= 0) return;
+    if(!searchSetKernel(UTF8_AVX2) && !searchSetKernel(UTF8_SSE2))
+        searchSetKernel(UTF8_SCALAR);
+}
+
+/* Chunk workers may make the first call together */
+static void init(void) {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, pick);
+}
+
+int searchGetKernel(void) {
+    init();
+    return kernel;
+}
+
+long searchFind(const searchPattern *p, const char *s, size_t len) {
+    init();
+    if(p->len == 0 || p->len > len) return -1;
+    if(p->len == 1) {
+        const char *m = memchr(s, p->needle[0], len);
+        return m ? m - s : -1;
+    }
+    return find(p, s, len);
+}
+
+long searchFindSplit(const searchPattern *p, const char *first, size_t firstLen,
+                     const char *second, size_t secondLen, size_t from) {
+    size_t n = p->len;
+    long r;
+
+    if(from < firstLen) {
+        r = searchFind(p, &first[from], firstLen - from);
+        if(r >= 0) return from + r;
+
+        // Matches which start in first and end in second
+        if(n > 1 && secondLen > 0) {
+            size_t start = firstLen > n - 1 ? firstLen - (n - 1) : 0;
+            if(start < from) start = from;
+            size_t head = firstLen - start;
+            size_t tail = secondLen < n - 1 ? secondLen : n - 1;
+            char stack[SPLIT_BUF_SIZE];
+            char *buf = stack;
+            if(head + tail > SPLIT_BUF_SIZE) buf = malloc(head + tail);
+            if(buf) {
+                memcpy(buf, &first[start], head);
+                memcpy(&buf[head], second, tail);
+                r = searchFind(p, buf, head + tail);
+                if(buf != stack) free(buf);
+                if(r >= 0 && (size_t)r < head) return start + r;
+            }
+        }
+    }
+
+    size_t skip = from > firstLen ? from - firstLen : 0;
+    if(skip >= secondLen) return -1;
+    r = searchFind(p, &second[skip], secondLen - skip);
+    return r < 0 ? -1 : (long)(firstLen + skip + r);
+}
+
+/*** workers ***/
+
+typedef struct searchJob {
+    int threads;           // Workers started
+    unsigned gen;          // Bumped by every start and cancel
+    searchPattern pat[SEARCH_MAX_PATTERNS];
+    char *needle[SEARCH_MAX_PATTERNS]; // Copies of the needles owned by the job
+    int npat;
+    int count;
+    int start;
+    int direction;
+    searchTextFunc text;
+    void *ctx;
+    int chunks;            // Chunks of this search
+    int next;              // Next chunk to take
+    int active;            // Chunks being scanned
+    int best;              // Chunk of the best hit, later ones are skipped
+    searchHit hit;
+} searchJob;
+
+static searchJob job;
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobWork = PTHREAD_COND_INITIALIZER; // Workers wait for chunks
+static pthread_cond_t jobDone = PTHREAD_COND_INITIALIZER; // Caller waits for the end
+
+/* Item at step (from 1) away from start */
+static int itemAt(int step) {
+    long at = (job.start + (long)job.direction * step) % job.count;
+    return at < 0 ? at + job.count : at;
+}
+
+/* Chunk k is not needed anymore */
+static int stale(int k, unsigned gen) {
+    pthread_mutex_lock(&jobLock);
+    int old = gen != job.gen || job.best < k;
+    pthread_mutex_unlock(&jobLock);
+    return old;
+}
+
+/* Item of the nearest hit in chunk k, -1 when none */
+static int scanChunk(int k, unsigned gen, long *offset) {
+    int from = k * SEARCH_CHUNK + 1;
+    int to = from + SEARCH_CHUNK;
+    if(to > job.count + 1) to = job.count + 1;
+
+    for(int step = from; step < to; step++) {
+        if((step - from) % SEARCH_CHECK == SEARCH_CHECK - 1 && stale(k, gen))
+            return -1;
+        int at = itemAt(step);
+        const char *first, *second;
+        size_t firstLen, secondLen;
+        job.text(job.ctx, at, &first, &firstLen, &second, &secondLen);
+
+        long best = -1;
+        for(int i = 0; i < job.npat; i++) {
+            long r = searchFindSplit(&job.pat[i], first, firstLen, second, secondLen, 0);
+            if(r < 0) continue;
+            if(job.direction < 0) {
+                long n;
+                while((n = searchFindSplit(&job.pat[i], first, firstLen,
+                                           second, secondLen, r + 1)) >= 0)
+                    r = n;
+            }
+            if(best < 0 || (job.direction < 0 ? r > best : r < best)) best = r;
+        }
+        if(best < 0) continue;
+        *offset = best;
+        return at;
+    }
+    return -1;
+}
+
+static int finished(void) {
+    return job.active == 0 && (job.next >= job.chunks || job.next >= job.best);
+}
+
+static void *worker(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&jobLock);
+    for(;;) {
+        while(job.next >= job.chunks || job.next >= job.best)
+            pthread_cond_wait(&jobWork, &jobLock);
+        int k = job.next++;
+        unsigned gen = job.gen;
+        job.active++;
+        pthread_mutex_unlock(&jobLock);
+
+        long offset = 0;
+        int item = scanChunk(k, gen, &offset);
+
+        pthread_mutex_lock(&jobLock);
+        job.active--;
+        if(gen == job.gen && item >= 0 && k < job.best) {
+            job.best = k;
+            job.hit.item = item;
+            job.hit.offset = offset;
+        }
+        if(finished())
+            pthread_cond_broadcast(&jobDone);
+    }
+    return NULL;
+}
+
+/* One worker per CPU, started on first search */
+static void startWorkers(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if(n < 1) n = 1;
+    if(n > SEARCH_MAX_THREADS) n = SEARCH_MAX_THREADS;
+    for(long i = 0; i < n; i++) {
+        pthread_t t;
+        if(pthread_create(&t, NULL, worker, NULL) != 0) break;
+        pthread_detach(t);
+        job.threads++;
+    }
+}
+
+void searchCancel(void) {
+    pthread_mutex_lock(&jobLock);
+    job.gen++;
+    job.chunks = 0;
+    job.next = 0;
+    while(job.active > 0)
+        pthread_cond_wait(&jobDone, &jobLock);
+    pthread_mutex_unlock(&jobLock);
+}
+
+void searchStart(const searchPattern *p, int npat, int count, int start, int direction,
+                 searchTextFunc text, void *ctx) {
+    init();
+    searchCancel();
+
+    pthread_mutex_lock(&jobLock);
+    if(job.threads == 0)
+        startWorkers();
+    if(npat > SEARCH_MAX_PATTERNS) npat = SEARCH_MAX_PATTERNS;
+    for(int i = 0; i < npat; i++) {
+        free(job.needle[i]);
+        job.needle[i] = malloc(p[i].len + 1);
+        if(job.needle[i])
+            memcpy(job.needle[i], p[i].needle, p[i].len);
+        searchCompile(&job.pat[i], job.needle[i], job.needle[i] ? p[i].len : 0);
+    }
+    job.npat = npat;
+    job.count = count;
+    job.start = start;
+    job.direction = direction < 0 ? -1 : 1;
+    job.text = text;
+    job.ctx = ctx;
+    job.chunks = count > 0 ? (count + SEARCH_CHUNK - 1) / SEARCH_CHUNK : 0;
+    job.next = 0;
+    job.best = job.chunks;
+    job.hit.item = -1;
+    job.hit.offset = -1;
+
+    if(job.threads == 0) {
+        // No thread at all, search here
+        unsigned gen = job.gen;
+        pthread_mutex_unlock(&jobLock);
+        for(int k = 0; k < job.chunks && job.hit.item < 0; k++)
+            job.hit.item = scanChunk(k, gen, &job.hit.offset);
+        job.next = job.chunks;
+        return;
+    }
+    pthread_cond_broadcast(&jobWork);
+    pthread_mutex_unlock(&jobLock);
+}
+
+int searchWait(searchHit *hit, int ms) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000;
+    if(ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&jobLock);
+    while(!finished()) {
+        if(pthread_cond_timedwait(&jobDone, &jobLock, &ts) == ETIMEDOUT)
+            break;
+    }
+    int done = finished();
+    if(done)
+        *hit = job.hit;
+    pthread_mutex_unlock(&jobLock);
+    return done;
+}
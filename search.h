@@ -0,0 +1,67 @@
+/* ============================================================
+   *File : search.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Substring search over text bytes
+   ============================================================ */
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <stddef.h>
+
+#define SEARCH_MAX_PATTERNS 2 // Patterns of one search on the workers
+
+/* Needle prepared once for many searches */
+typedef struct searchPattern searchPattern;
+struct searchPattern {
+    const char *needle; // Not copied, must live as long as the pattern
+    size_t len;
+    size_t skip[256];   // Horspool shift by last byte of the window
+};
+
+void searchCompile(searchPattern *p, const char *needle, size_t len);
+
+/* Byte offset of the first match in s, -1 when none. An empty needle
+ * matches nothing */
+long searchFind(const searchPattern *p, const char *s, size_t len);
+
+/* Same on text held in two parts, like a gap buffer. Offsets count
+ * both parts as one text and matches crossing from first to second are
+ * found too. First match starting at or after from, -1 when none */
+long searchFindSplit(const searchPattern *p, const char *first, size_t firstLen,
+                     const char *second, size_t secondLen, size_t from);
+
+/* Text of item at for the workers, given as two parts. Called from
+ * worker threads so it must only read */
+typedef void (*searchTextFunc)(void *ctx, int at, const char **first, size_t *firstLen,
+                               const char **second, size_t *secondLen);
+
+/* Match found by the workers, item is -1 when there is none */
+typedef struct searchHit searchHit;
+struct searchHit {
+    int item;
+    long offset;
+};
+
+/* Search items start + direction, start + 2 * direction ... of count
+ * items on worker threads, wrapping at both ends, for any of npat
+ * patterns. Going forward the first match of an item is kept, going
+ * backward the last one. Items nearest to start win. Return at once, a
+ * running search is cancelled. Items must not change until the search
+ * is done or cancelled */
+void searchStart(const searchPattern *p, int npat, int count, int start, int direction,
+                 searchTextFunc text, void *ctx);
+
+/* Wait at most ms for the search, 1 with hit set when it is done */
+int searchWait(searchHit *hit, int ms);
+
+/* Stop the running search, return when no worker reads items anymore */
+void searchCancel(void);
+
+/* Kernel in use, one of UTF8_SCALAR, UTF8_SSE2, UTF8_AVX2 */
+int searchGetKernel(void);
+
+/* Use another kernel, return 0 when CPU does not support it */
+int searchSetKernel(int kernel);
+
+#endif // End SEARCH_H
@@ -0,0 +1,88 @@
+/* ============================================================
+   *File : undotest.c
+   *Date : 2026-10-18
+   *Creator : @congdv
+   *Description : Checks of the undo log. An edit bigger than the log
+   must not take the steps before it away, it becomes a barrier which
+   undo stops at, steps after it are undone and redone as before.
+   Usage: undotest, exit status is the number of failed checks
+   ============================================================ */
+#include "../undo.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define BUDGET 4096
+
+static int failed = 0;
+static int calls = 0;
+static char seen[64];
+
+static void check(int ok, const char *what) {
+    if(ok) return;
+    fprintf(stderr, "FAIL %s\n", what);
+    failed++;
+}
+
+static void record(void *ctx, const undoRecord *r, int redo) {
+    (void)ctx;
+    (void)redo;
+    calls++;
+    snprintf(seen, sizeof(seen), "%d %d %.*s", r->op, r->row, r->len, r->bytes);
+}
+
+/* Step of one record with text at row */
+static void step(undoLog *u, int op, int row, const char *text, int len) {
+    undoRecord r = {op, row, 0, op == UNDO_INSERT || op == UNDO_DELETE ? len : 0, 0, text, len};
+    undoBegin(u, 0, row);
+    undoAdd(u, &r);
+    undoEnd(u, 0, row);
+}
+
+static int undo(undoLog *u, int redo) {
+    int cx, cy;
+    calls = 0;
+    seen[0] = '\0';
+    return undoStep(u, redo, record, NULL, &cx, &cy);
+}
+
+int main(void) {
+    static char big[BUDGET * 2];
+    memset(big, 'x', sizeof(big));
+
+    // Typed runs on two rows, then a row bigger than the log goes away
+    undoLog *u = undoNew(BUDGET);
+    step(u, UNDO_INSERT, 0, "abc", 3);
+    step(u, UNDO_INSERT, 1, "def", 3);
+    check(undoSteps(u) == 2, "two runs are kept");
+    step(u, UNDO_DEL_ROW, 2, big, sizeof(big));
+    check(undoSteps(u) == 3, "runs before a big edit are kept");
+    step(u, UNDO_INSERT, 3, "ghi", 3);
+
+    // Step after the barrier goes and comes back
+    check(undo(u, 0) == 1 && calls == 1 && !strcmp(seen, "1 3 ghi"), "undo after the barrier");
+    check(undo(u, 1) == 1 && calls == 1 && !strcmp(seen, "1 3 ghi"), "redo after the barrier");
+    check(undo(u, 0) == 1, "undo after the barrier again");
+
+    // Barrier is not undone and nothing of it is applied
+    check(undo(u, 0) == -1 && calls == 0, "undo stops at the barrier");
+    check(undo(u, 0) == -1 && calls == 0, "undo stays at the barrier");
+    check(undoSteps(u) == 4, "runs are still kept after the barrier");
+    undoFree(u);
+
+    // Records of a step made before it grew too big are not applied
+    u = undoNew(BUDGET);
+    step(u, UNDO_INSERT, 0, "abc", 3);
+    undoRecord small = {UNDO_INSERT_ROW, 1, 0, 0, 0, "row", 3};
+    undoRecord huge = {UNDO_INSERT_ROW, 2, 0, 0, 0, big, sizeof(big)};
+    undoBegin(u, 0, 1);
+    undoAdd(u, &small);
+    undoAdd(u, &huge);
+    undoEnd(u, 0, 2);
+    check(undoSteps(u) == 2, "run before a big step is kept");
+    check(undo(u, 0) == -1 && calls == 0, "big step is not undone in part");
+    undoFree(u);
+
+    if(failed == 0) printf("undotest: all checks passed\n");
+    return failed;
+}
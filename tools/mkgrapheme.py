@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# ============================================================
+#   *File : mkgrapheme.py
+#   *Date : 2026-10-17
+#   *Creator : @congdv
+#   *Description : Write graphemetab.h, the width and grapheme break
+#   class of every code point, from the Unicode data of Python:
+#
+#       python3 tools/mkgrapheme.py > graphemetab.h
+#
+#   Each byte of the table is width | class << 2. Code points are in
+#   blocks of GR_BLOCK, blocks which are the same are stored once.
+# ============================================================
+import sys
+import unicodedata
+
+BLOCK = 128
+
+# Break classes, same order as enum grClass in grapheme.h
+OTHER, CONTROL, EXTEND, ZWJ, REGIONAL, PREPEND, SPACING, \
+    L, V, T, LV, LVT, PICTO = range(13)
+
+PREPEND_CHARS = [(0x0600, 0x0605), (0x06DD, 0x06DD), (0x070F, 0x070F),
+                 (0x0890, 0x0891), (0x08E2, 0x08E2), (0x0D4E, 0x0D4E),
+                 (0x110BD, 0x110BD), (0x110CD, 0x110CD), (0x111C2, 0x111C3),
+                 (0x1193F, 0x1193F), (0x11941, 0x11941), (0x11A3A, 0x11A3A),
+                 (0x11A84, 0x11A89), (0x11D46, 0x11D46)]
+
+# Extended_Pictographic is not in unicodedata, these are the ranges
+# of emoji-data.txt which are not plain letters
+PICTO_CHARS = [(0x00A9, 0x00A9), (0x00AE, 0x00AE), (0x203C, 0x203C),
+               (0x2049, 0x2049), (0x2122, 0x2122), (0x2139, 0x2139),
+               (0x2194, 0x2199), (0x21A9, 0x21AA), (0x231A, 0x231B),
+               (0x2328, 0x2328), (0x2388, 0x2388), (0x23CF, 0x23CF),
+               (0x23E9, 0x23F3), (0x23F8, 0x23FA), (0x24C2, 0x24C2),
+               (0x25AA, 0x25AB), (0x25B6, 0x25B6), (0x25C0, 0x25C0),
+               (0x25FB, 0x25FE), (0x2600, 0x2605), (0x2607, 0x2612),
+               (0x2614, 0x2685), (0x2690, 0x2705), (0x2708, 0x2712),
+               (0x2714, 0x2714), (0x2716, 0x2716), (0x271D, 0x271D),
+               (0x2721, 0x2721), (0x2728, 0x2728), (0x2733, 0x2734),
+               (0x2744, 0x2744), (0x2747, 0x2747), (0x274C, 0x274C),
+               (0x274E, 0x274E), (0x2753, 0x2755), (0x2757, 0x2757),
+               (0x2763, 0x2767), (0x2795, 0x2797), (0x27A1, 0x27A1),
+               (0x27B0, 0x27B0), (0x27BF, 0x27BF), (0x2934, 0x2935),
+               (0x2B05, 0x2B07), (0x2B1B, 0x2B1C), (0x2B50, 0x2B50),
+               (0x2B55, 0x2B55), (0x3030, 0x3030), (0x303D, 0x303D),
+               (0x3297, 0x3297), (0x3299, 0x3299), (0x1F000, 0x1F0FF),
+               (0x1F10D, 0x1F10F), (0x1F12F, 0x1F12F), (0x1F16C, 0x1F171),
+               (0x1F17E, 0x1F17F), (0x1F18E, 0x1F18E), (0x1F191, 0x1F19A),
+               (0x1F1AD, 0x1F1E5), (0x1F201, 0x1F20F), (0x1F21A, 0x1F21A),
+               (0x1F22F, 0x1F22F), (0x1F232, 0x1F23A), (0x1F23C, 0x1F23F),
+               (0x1F249, 0x1F3FA), (0x1F400, 0x1F53D), (0x1F546, 0x1F64F),
+               (0x1F680, 0x1F6FF), (0x1F774, 0x1F77F), (0x1F7D5, 0x1F7FF),
+               (0x1F80C, 0x1F80F), (0x1F848, 0x1F84F), (0x1F85A, 0x1F85F),
+               (0x1F888, 0x1F88F), (0x1F8AE, 0x1F8FF), (0x1F90C, 0x1F93A),
+               (0x1F93C, 0x1F945), (0x1F947, 0x1FAFF), (0x1FC00, 0x1FFFD)]
+
+# Wide by default even where nothing is assigned yet
+WIDE_BLOCKS = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+               (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+
+def inRanges(cp, ranges):
+    return any(a <= cp <= b for a, b in ranges)
+
+
+def breakClass(cp, cat):
+    if 0xAC00 <= cp <= 0xD7A3:
+        return LV if (cp - 0xAC00) % 28 == 0 else LVT
+    if 0x1100 <= cp <= 0x115F or 0xA960 <= cp <= 0xA97C:
+        return L
+    if 0x1160 <= cp <= 0x11A7 or 0xD7B0 <= cp <= 0xD7C6:
+        return V
+    if 0x11A8 <= cp <= 0x11FF or 0xD7CB <= cp <= 0xD7FB:
+        return T
+    if cp == 0x200D:
+        return ZWJ
+    if 0x1F1E6 <= cp <= 0x1F1FF:
+        return REGIONAL
+    if inRanges(cp, PREPEND_CHARS):
+        return PREPEND
+    if cat in ('Mn', 'Me') or cp == 0x200C or 0xFF9E <= cp <= 0xFF9F or \
+            0x1F3FB <= cp <= 0x1F3FF or 0xE0020 <= cp <= 0xE007F:
+        return EXTEND
+    if cat in ('Cc', 'Zl', 'Zp') or (cat == 'Cf' and cp != 0x00AD):
+        return CONTROL
+    if cat == 'Mc':
+        return SPACING
+    if inRanges(cp, PICTO_CHARS):
+        return PICTO
+    return OTHER
+
+
+def width(cp, cat):
+    if cat in ('Mn', 'Me') or (cat == 'Cf' and cp != 0x00AD) or cp == 0x200B:
+        return 0
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+        return 0
+    if unicodedata.east_asian_width(chr(cp)) in ('W', 'F'):
+        return 2
+    if inRanges(cp, WIDE_BLOCKS):
+        return 2
+    return 1
+
+
+def main():
+    values = []
+    for cp in range(0x110000):
+        cat = unicodedata.category(chr(cp))
+        values.append(width(cp, cat) | breakClass(cp, cat) << 2)
+
+    blocks = []
+    index = {}
+    stage1 = []
+    for start in range(0, 0x110000, BLOCK):
+        block = tuple(values[start:start + BLOCK])
+        if block not in index:
+            index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(index[block])
+
+    out = sys.stdout
+    out.write('/* Made by tools/mkgrapheme.py from Unicode %s, do not edit */\n'
+              % unicodedata.unidata_version)
+    out.write('#define GR_BLOCK %d\n\n' % BLOCK)
+    kind = 'unsigned char' if len(blocks) <= 256 else 'unsigned short'
+    out.write('static const %s grStage1[%d] = {\n' % (kind, len(stage1)))
+    for i in range(0, len(stage1), 16):
+        out.write('    ' + ','.join('%d' % v for v in stage1[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('static const unsigned char grStage2[%d] = {\n' % (len(blocks) * BLOCK))
+    for block in blocks:
+        for i in range(0, BLOCK, 32):
+            out.write('    ' + ','.join('%d' % v for v in block[i:i + 32]) + ',\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# ============================================================
+#   *File : mknormal.py
+#   *Date : 2026-10-17
+#   *Creator : @congdv
+#   *Description : Write normaltab.h, the tables of canonical
+#   normalization (NFC and NFD) from the Unicode data of Python:
+#
+#       python3 tools/mknormal.py > normaltab.h
+#
+#   normInfo is a two stage table like the one of graphemetab.h, each
+#   entry is the combining class | NORM_* flags. Full decompositions
+#   and compositions are sorted lists for a binary search.
+# ============================================================
+import sys
+import unicodedata
+
+BLOCK = 128
+NFD_NO = 0x100     # Not in NFD, it has a decomposition
+NFC_NO = 0x200     # Never in NFC
+NFC_MAYBE = 0x400  # May join the character before in NFC
+
+SBASE, SCOUNT = 0xAC00, 11172  # Hangul syllables are done in code
+
+
+def isChar(cp):
+    return not 0xD800 <= cp <= 0xDFFF
+
+
+def main():
+    ccc = [0] * 0x110000
+    decomp = {}
+    for cp in range(0x110000):
+        if not isChar(cp):
+            continue
+        c = chr(cp)
+        ccc[cp] = unicodedata.combining(c)
+        if SBASE <= cp < SBASE + SCOUNT:
+            continue
+        d = unicodedata.normalize('NFD', c)
+        if d != c:
+            decomp[cp] = [ord(x) for x in d]
+
+    # Pairs which NFC puts together, from decompositions of two
+    # characters which NFC keeps
+    compose = {}
+    for cp in range(0x110000):
+        if not isChar(cp) or SBASE <= cp < SBASE + SCOUNT:
+            continue
+        raw = unicodedata.decomposition(chr(cp))
+        if not raw or raw.startswith('<'):
+            continue
+        parts = [int(x, 16) for x in raw.split()]
+        if len(parts) == 2 and unicodedata.normalize('NFC', chr(cp)) == chr(cp):
+            compose[(parts[0], parts[1])] = cp
+    seconds = {b for (a, b) in compose}
+    seconds.update(range(0x1161, 0x1176))  # Hangul vowels and trailing
+    seconds.update(range(0x11A8, 0x11C3))  # consonants join syllables
+
+    info = [0] * 0x110000
+    growth = 1
+    for cp in range(0x110000):
+        if not isChar(cp):
+            continue
+        c = chr(cp)
+        v = ccc[cp]
+        if cp in decomp or SBASE <= cp < SBASE + SCOUNT:
+            v |= NFD_NO
+        if unicodedata.normalize('NFC', c) != c:
+            v |= NFC_NO
+        if cp in seconds:
+            v |= NFC_MAYBE
+        info[cp] = v
+        for form in ('NFC', 'NFD'):
+            n = unicodedata.normalize(form, c)
+            growth = max(growth, -(-len(n.encode()) // len(c.encode())))
+
+    blocks = []
+    index = {}
+    stage1 = []
+    for start in range(0, 0x110000, BLOCK):
+        block = tuple(info[start:start + BLOCK])
+        if block not in index:
+            index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(index[block])
+
+    out = sys.stdout
+    out.write('/* Made by tools/mknormal.py from Unicode %s, do not edit */\n'
+              % unicodedata.unidata_version)
+    out.write('#define NORM_BLOCK %d\n' % BLOCK)
+    out.write('#define NORM_MAX_GROWTH %d // Bytes of a result per byte of text\n\n' % growth)
+    kind = 'unsigned char' if len(blocks) <= 256 else 'unsigned short'
+    out.write('static const %s normStage1[%d] = {\n' % (kind, len(stage1)))
+    for i in range(0, len(stage1), 16):
+        out.write('    ' + ','.join('%d' % v for v in stage1[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('static const unsigned short normStage2[%d] = {\n' % (len(blocks) * BLOCK))
+    for block in blocks:
+        for i in range(0, BLOCK, 16):
+            out.write('    ' + ','.join('%d' % v for v in block[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+
+    # Decompositions: code point, first entry in normDecompChars, count
+    chars = []
+    out.write('static const unsigned normDecomp[%d][3] = {\n' % len(decomp))
+    for cp in sorted(decomp):
+        out.write('    {0x%X,%d,%d},\n' % (cp, len(chars), len(decomp[cp])))
+        chars.extend(decomp[cp])
+    out.write('};\n\n')
+    out.write('static const unsigned normDecompChars[%d] = {\n' % len(chars))
+    for i in range(0, len(chars), 8):
+        out.write('    ' + ','.join('0x%X' % v for v in chars[i:i + 8]) + ',\n')
+    out.write('};\n\n')
+
+    out.write('static const unsigned normCompose[%d][3] = {\n' % len(compose))
+    for (a, b) in sorted(compose):
+        out.write('    {0x%X,0x%X,0x%X},\n' % (a, b, compose[(a, b)]))
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
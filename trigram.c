@@ -0,0 +1,192 @@
+/* ============================================================
+   *File : trigram.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Key of a trigram is its three code points packed in
+   63 bits. Keys live in an open addressing hash table, each key has
+   a list of ids stored as varint of the difference from the id
+   before (zigzag so an older id can follow a newer one):
+
+       "chà" -> [12][+1][+40][-3]...
+
+   Rows are added in order when the index is built so differences are
+   small and most ids take one byte. The same id twice in a row is
+   stored once.
+   ============================================================ */
+#include "trigram.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRI_MIN_SLOTS 1024
+#define TRI_MIN_LIST 4
+
+typedef struct triList {
+    uint64_t key;        // Trigram + 1, 0 when slot is empty
+    unsigned char *data; // Varint differences
+    unsigned len;        // Bytes used in data
+    unsigned cap;
+    unsigned last;       // Last id added
+    unsigned count;      // Ids in the list
+} triList;
+
+struct trigramIndex {
+    triList *slots;
+    size_t cap;   // Power of 2
+    size_t used;
+    size_t bytes; // Memory of slots and lists
+};
+
+trigramIndex *triNew(void) {
+    trigramIndex *t = malloc(sizeof(trigramIndex));
+    if(t == NULL) return NULL;
+    t->cap = TRI_MIN_SLOTS;
+    t->used = 0;
+    t->slots = calloc(t->cap, sizeof(triList));
+    t->bytes = sizeof(trigramIndex) + t->cap * sizeof(triList);
+    if(t->slots == NULL) {
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void triFree(trigramIndex *t) {
+    if(t == NULL) return;
+    for(size_t i = 0; i < t->cap; i++)
+        free(t->slots[i].data);
+    free(t->slots);
+    free(t);
+}
+
+size_t triMemory(trigramIndex *t) {
+    return t->bytes;
+}
+
+static size_t hash(uint64_t key) {
+    key *= 0x9E3779B97F4A7C15ull;
+    return (size_t)(key ^ (key >> 29));
+}
+
+/* Slot of key, an empty one when key is not in the table */
+static triList *findSlot(triList *slots, size_t cap, uint64_t key) {
+    size_t i = hash(key) & (cap - 1);
+    while(slots[i].key != 0 && slots[i].key != key)
+        i = (i + 1) & (cap - 1);
+    return &slots[i];
+}
+
+static int grow(trigramIndex *t) {
+    size_t cap = t->cap * 2;
+    triList *slots = calloc(cap, sizeof(triList));
+    if(slots == NULL) return 0;
+    for(size_t i = 0; i < t->cap; i++) {
+        if(t->slots[i].key != 0)
+            *findSlot(slots, cap, t->slots[i].key) = t->slots[i];
+    }
+    free(t->slots);
+    t->bytes += (cap - t->cap) * sizeof(triList);
+    t->slots = slots;
+    t->cap = cap;
+    return 1;
+}
+
+static void addId(trigramIndex *t, uint64_t key, unsigned id) {
+    if((t->used + 1) * 10 > t->cap * 7 && !grow(t))
+        return;
+    triList *l = findSlot(t->slots, t->cap, key + 1);
+    if(l->key == 0) {
+        l->key = key + 1;
+        t->used++;
+    } else if(l->last == id) {
+        return;
+    }
+
+    if(l->len + 5 > l->cap) {
+        unsigned cap = l->cap ? l->cap * 2 : TRI_MIN_LIST;
+        unsigned char *data = realloc(l->data, cap);
+        if(data == NULL) return;
+        t->bytes += cap - l->cap;
+        l->data = data;
+        l->cap = cap;
+    }
+    long diff = (long)id - (long)l->last;
+    unsigned long v = diff < 0 ? ((unsigned long)-diff << 1) - 1 : (unsigned long)diff << 1;
+    while(v >= 0x80) {
+        l->data[l->len++] = (v & 0x7F) | 0x80;
+        v >>= 7;
+    }
+    l->data[l->len++] = v;
+    l->last = id;
+    l->count++;
+}
+
+/* Code point at pos of the text in two parts, pos moves past it.
+ * A broken byte is taken as it is */
+static unsigned nextChar(const char *first, size_t firstLen, const char *second,
+                         size_t total, size_t *pos) {
+    size_t i = *pos;
+    unsigned char c = i < firstLen ? first[i] : second[i - firstLen];
+    int n = c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    unsigned cp = n == 1 ? c : c & (0x3F >> (n - 1));
+    if(i + n > total) n = 1;
+    for(int k = 1; k < n; k++) {
+        size_t j = i + k;
+        c = j < firstLen ? first[j] : second[j - firstLen];
+        cp = (cp << 6) | (c & 0x3F);
+    }
+    *pos = i + n;
+    return cp & 0x1FFFFF;
+}
+
+void triAdd(trigramIndex *t, unsigned id, const char *first, size_t firstLen,
+            const char *second, size_t secondLen) {
+    size_t total = firstLen + secondLen;
+    size_t pos = 0;
+    uint64_t key = 0;
+    int have = 0;
+    while(pos < total) {
+        unsigned cp = nextChar(first, firstLen, second, total, &pos);
+        key = ((key << 21) | cp) & ((1ull << 63) - 1);
+        if(++have >= 3)
+            addId(t, key, id);
+    }
+}
+
+long triQuery(trigramIndex *t, const char *query, size_t len, unsigned **ids) {
+    size_t pos = 0;
+    uint64_t key = 0;
+    int have = 0;
+    triList *best = NULL;
+    *ids = NULL;
+
+    // The shortest list of the query trigrams
+    while(pos < len) {
+        unsigned cp = nextChar(query, len, NULL, len, &pos);
+        key = ((key << 21) | cp) & ((1ull << 63) - 1);
+        if(++have < 3) continue;
+        triList *l = findSlot(t->slots, t->cap, key + 1);
+        if(l->key == 0) return 0;
+        if(best == NULL || l->count < best->count) best = l;
+    }
+    if(best == NULL) return -1;
+
+    unsigned *out = malloc(best->count * sizeof(unsigned));
+    if(out == NULL) return -1;
+    long n = 0;
+    unsigned id = 0;
+    unsigned i = 0;
+    while(i < best->len) {
+        unsigned long v = 0;
+        int shift = 0;
+        do {
+            v |= (unsigned long)(best->data[i] & 0x7F) << shift;
+            shift += 7;
+        } while(best->data[i++] & 0x80);
+        id = v & 1 ? id - (unsigned)((v + 1) >> 1) : id + (unsigned)(v >> 1);
+        out[n++] = id;
+    }
+    *ids = out;
+    return n;
+}
@@ -0,0 +1,32 @@
+/* ============================================================
+   *File : trigram.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Index from each three characters in a text to the
+   ids of texts which have them
+   ============================================================ */
+#ifndef TRIGRAM_H
+#define TRIGRAM_H
+
+#include <stddef.h>
+
+typedef struct trigramIndex trigramIndex;
+
+trigramIndex *triNew(void);
+
+void triFree(trigramIndex *t);
+
+/* Add every three characters of a utf-8 text given in two parts to
+ * id. Nothing is ever removed, a changed text only adds its new ones */
+void triAdd(trigramIndex *t, unsigned id, const char *first, size_t firstLen,
+            const char *second, size_t secondLen);
+
+/* Ids which may hold query, they still have to be checked. Return
+ * the number of ids in *ids (free it), -1 when query is shorter than
+ * three characters so the index can not help */
+long triQuery(trigramIndex *t, const char *query, size_t len, unsigned **ids);
+
+/* Bytes used by the index */
+size_t triMemory(trigramIndex *t);
+
+#endif // End TRIGRAM_H
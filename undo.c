@@ -0,0 +1,319 @@
+/* ============================================================
+   *File : undo.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Steps live one after another in a ring buffer, a
+   step is a header then its records:
+
+       [step][rec][bytes][rec][bytes]  [step][rec][bytes]  ...
+        prev/next link steps, each rec knows the size of the one before
+
+   A new step goes after the last one, when it does not fit it goes to
+   the start of the ring and oldest steps are dropped until it fits.
+   Typing and deleting characters one by one makes a single record
+   which grows, so undo of a run costs its length. A step bigger than
+   the whole ring keeps no records and becomes a barrier: steps before
+   it stay, undo stops there as they do not fit the text after it.
+   ============================================================ */
+#include "undo.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UNDO_ALIGN(n) (((n) + 7) & ~7)
+#define UNDO_MIN_BUDGET 4096
+
+enum undoRun {
+    RUN_ONE = 0, // Single character, direction is not known yet
+    RUN_FORWARD,
+    RUN_BACK
+};
+
+typedef struct stepHead {
+    int size;    // Bytes of header and records
+    int prev;    // Offset of the step before, -1 for none
+    int next;
+    int records;
+    int barrier; // Step was too big to keep, it can not be undone
+    int lastRec; // Offset of the last record from the step
+    int cxBefore, cyBefore;
+    int cxAfter, cyAfter;
+} stepHead;
+
+typedef struct recHead {
+    int op;
+    int row;
+    int col;
+    int count;
+    int run;      // enum undoRun
+    int len;      // Bytes following the header
+    int prevSize; // Bytes of the record before in the step
+} recHead;
+
+struct undoLog {
+    char *buf;
+    int cap;
+    int first;  // Oldest step, -1 when log is empty
+    int last;   // Newest step which can be undone, -1 for none
+    int top;    // Newest step, the ones after last can be redone
+    int open;   // Between undoBegin and undoEnd
+    int step;   // Step taking records now, -1 until the first one
+    int skip;   // Step did not fit, rest of it is not recorded
+    int cx, cy; // Cursor at undoBegin
+};
+
+#define STEP_HEAD UNDO_ALIGN((int)sizeof(stepHead))
+
+static stepHead *head(undoLog *u, int off) {
+    return (stepHead *)&u->buf[off];
+}
+
+static recHead *rec(undoLog *u, int step, int off) {
+    return (recHead *)&u->buf[step + off];
+}
+
+static int recSize(int len) {
+    return UNDO_ALIGN((int)sizeof(recHead) + len);
+}
+
+undoLog *undoNew(size_t budget) {
+    undoLog *u = calloc(1, sizeof(undoLog));
+    if(u == NULL) return NULL;
+    if(budget < UNDO_MIN_BUDGET) budget = UNDO_MIN_BUDGET;
+    if(budget > INT_MAX / 2) budget = INT_MAX / 2;
+    u->cap = UNDO_ALIGN((int)budget);
+    u->buf = malloc(u->cap);
+    if(u->buf == NULL) {
+        free(u);
+        return NULL;
+    }
+    u->first = u->last = u->top = u->step = -1;
+    return u;
+}
+
+void undoFree(undoLog *u) {
+    if(u == NULL) return;
+    free(u->buf);
+    free(u);
+}
+
+static void clear(undoLog *u) {
+    u->first = u->last = u->top = u->step = -1;
+}
+
+static void dropFirst(undoLog *u) {
+    if(u->first == u->top) {
+        clear(u);
+        return;
+    }
+    if(u->first == u->last) u->last = -1;
+    u->first = head(u, u->first)->next;
+    head(u, u->first)->prev = -1;
+}
+
+/* Drop oldest steps lying at from or after it. Used when the ring
+ * wraps, steps at its end are older than the ones at its start */
+static void dropFrom(undoLog *u, int from, int keep) {
+    while(u->first != -1 && u->first != keep && u->first >= from)
+        dropFirst(u);
+}
+
+/* Drop oldest steps until [pos, pos + size) is free */
+static void evict(undoLog *u, int pos, int size, int keep) {
+    while(u->first != -1 && u->first != keep && u->first < pos + size &&
+          pos < u->first + head(u, u->first)->size)
+        dropFirst(u);
+}
+
+/* Put an empty step after the last one, return its offset */
+static int newStep(undoLog *u) {
+    // Steps which could be redone are gone
+    if(u->last == -1) {
+        clear(u);
+    } else {
+        u->top = u->last;
+        head(u, u->last)->next = -1;
+    }
+
+    int pos = u->last == -1 ? 0 : u->last + head(u, u->last)->size;
+    if(pos + STEP_HEAD > u->cap) {
+        dropFrom(u, pos, -1);
+        pos = 0;
+    }
+    evict(u, pos, STEP_HEAD, -1);
+
+    stepHead *h = head(u, pos);
+    h->size = STEP_HEAD;
+    h->prev = u->last;
+    h->next = -1;
+    h->records = 0;
+    h->barrier = 0;
+    h->lastRec = 0;
+    h->cxBefore = h->cxAfter = u->cx;
+    h->cyBefore = h->cyAfter = u->cy;
+    if(u->last == -1) u->first = pos;
+    else head(u, u->last)->next = pos;
+    u->last = u->top = pos;
+    return pos;
+}
+
+/* Make the open step size bytes, it may move to the start of the ring.
+ * Return 0 when it can not fit, the step is a barrier then */
+static int growStep(undoLog *u, int size) {
+    int s = u->step;
+    int old = head(u, s)->size;
+    if(size > u->cap) {
+        stepHead *h = head(u, s);
+        h->size = STEP_HEAD;
+        h->records = 0;
+        h->lastRec = 0;
+        h->barrier = 1;
+        u->skip = 1;
+        return 0;
+    }
+
+    if(s + size <= u->cap) {
+        evict(u, s + old, size - old, s);
+    } else {
+        dropFrom(u, s + old, s);
+        evict(u, 0, size, s);
+        memmove(u->buf, &u->buf[s], old);
+        stepHead *h = head(u, 0);
+        if(h->prev == -1) u->first = 0;
+        else head(u, h->prev)->next = 0;
+        u->last = u->top = u->step = s = 0;
+    }
+    head(u, s)->size = size;
+    return 1;
+}
+
+static void addRecord(undoLog *u, const undoRecord *r) {
+    int at = head(u, u->step)->size;
+    if(!growStep(u, at + recSize(r->len))) return;
+
+    stepHead *h = head(u, u->step);
+    recHead *rh = rec(u, u->step, at);
+    rh->op = r->op;
+    rh->row = r->row;
+    rh->col = r->col;
+    rh->count = r->count;
+    rh->run = RUN_ONE;
+    rh->len = r->len;
+    rh->prevSize = h->records ? at - h->lastRec : 0;
+    if(r->len) memcpy(rh + 1, r->bytes, r->len);
+    h->lastRec = at;
+    h->records++;
+}
+
+/* How r carries on the run of record l, RUN_ONE when it does not */
+static int joinRun(recHead *l, const undoRecord *r) {
+    if(r->count != 1 || l->op != r->op || l->row != r->row) return RUN_ONE;
+    if(r->op == UNDO_INSERT) {
+        // Word after a space starts a new step
+        char end = ((char *)(l + 1))[l->len - 1];
+        if((end == ' ' || end == '\t') && r->bytes[0] != ' ' && r->bytes[0] != '\t')
+            return RUN_ONE;
+        return r->col == l->col + l->count ? RUN_FORWARD : RUN_ONE;
+    }
+    if(r->op == UNDO_DELETE) {
+        if(r->col == l->col && l->run != RUN_BACK) return RUN_FORWARD;
+        if(r->col + 1 == l->col && l->run != RUN_FORWARD) return RUN_BACK;
+    }
+    return RUN_ONE;
+}
+
+/* Add the character of r to the last record of the last step */
+static void extendRun(undoLog *u, const undoRecord *r, int run) {
+    int at = head(u, u->step)->lastRec;
+    int len = rec(u, u->step, at)->len;
+    if(!growStep(u, at + recSize(len + r->len))) return;
+
+    recHead *rh = rec(u, u->step, at);
+    memcpy((char *)(rh + 1) + len, r->bytes, r->len);
+    rh->len += r->len;
+    rh->count++;
+    if(r->op == UNDO_DELETE) rh->run = run;
+    if(run == RUN_BACK) rh->col = r->col;
+}
+
+void undoBegin(undoLog *u, int cx, int cy) {
+    u->open = 1;
+    u->step = -1;
+    u->skip = 0;
+    u->cx = cx;
+    u->cy = cy;
+}
+
+void undoAdd(undoLog *u, const undoRecord *r) {
+    if(!u->open || u->skip) return;
+    if((r->op == UNDO_INSERT || r->op == UNDO_DELETE) && r->count == 0) return;
+
+    if(u->step == -1) {
+        // Nothing was undone since the step before and the cursor did
+        // not move, so a character may join its run
+        if(u->last != -1 && u->last == u->top) {
+            stepHead *h = head(u, u->last);
+            if(h->records && h->cxAfter == u->cx && h->cyAfter == u->cy) {
+                int run = joinRun(rec(u, u->last, h->lastRec), r);
+                if(run != RUN_ONE) {
+                    u->step = u->last;
+                    extendRun(u, r, run);
+                    return;
+                }
+            }
+        }
+        u->step = newStep(u);
+    }
+    addRecord(u, r);
+}
+
+void undoEnd(undoLog *u, int cx, int cy) {
+    if(u->open && u->step != -1 && !u->skip) {
+        head(u, u->step)->cxAfter = cx;
+        head(u, u->step)->cyAfter = cy;
+    }
+    u->open = 0;
+    u->step = -1;
+    u->skip = 0;
+}
+
+int undoStep(undoLog *u, int redo, void (*fn)(void *ctx, const undoRecord *r, int redo),
+             void *ctx, int *cx, int *cy) {
+    int s;
+    if(redo) {
+        if(u->last == u->top) return 0;
+        s = u->last == -1 ? u->first : head(u, u->last)->next;
+    } else {
+        if(u->last == -1) return 0;
+        s = u->last;
+        if(head(u, s)->barrier) return -1;
+    }
+
+    // Edits made by fn are not new steps
+    int open = u->open;
+    u->open = 0;
+
+    stepHead *h = head(u, s);
+    int at = redo ? STEP_HEAD : h->lastRec;
+    for(int i = 0; i < h->records; i++) {
+        recHead *rh = rec(u, s, at);
+        undoRecord r = {rh->op, rh->row, rh->col, rh->count, rh->run == RUN_BACK,
+                        (const char *)(rh + 1), rh->len};
+        at = redo ? at + recSize(rh->len) : at - rh->prevSize;
+        fn(ctx, &r, redo);
+    }
+
+    *cx = redo ? h->cxAfter : h->cxBefore;
+    *cy = redo ? h->cyAfter : h->cyBefore;
+    u->last = redo ? s : h->prev;
+    u->open = open;
+    return 1;
+}
+
+int undoSteps(const undoLog *u) {
+    int n = 0;
+    for(int s = u->first; s != -1; s = ((const stepHead *)&u->buf[s])->next)
+        n++;
+    return n;
+}
@@ -0,0 +1,61 @@
+/* ============================================================
+   *File : undo.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Undo and redo log of edits kept in a ring buffer
+   of fixed size, oldest steps are dropped when it is full
+   ============================================================ */
+#ifndef UNDO_H
+#define UNDO_H
+
+#include <stddef.h>
+
+typedef struct undoLog undoLog;
+
+enum undoOp {
+    UNDO_INSERT = 1, // count characters in bytes were put at row, col
+    UNDO_DELETE,     // count characters in bytes were taken from row, col
+    UNDO_INSERT_ROW, // Row with bytes was put at row
+    UNDO_DEL_ROW     // Row with bytes was taken from row
+};
+
+/* One edit. For an UNDO_DELETE made by backspace the characters are
+ * in the order they were deleted, so last one is the leftmost */
+typedef struct undoRecord undoRecord;
+struct undoRecord {
+    int op;
+    int row;
+    int col;
+    int count;
+    int backward;
+    const char *bytes;
+    int len;
+};
+
+/* New log which uses at most budget bytes */
+undoLog *undoNew(size_t budget);
+
+void undoFree(undoLog *u);
+
+/* Start a step, edits added until undoEnd() are undone together.
+ * cx, cy is the cursor to go back to */
+void undoBegin(undoLog *u, int cx, int cy);
+
+/* Add an edit to the step. A one character insert or delete next to
+ * the run of the step before is joined to it */
+void undoAdd(undoLog *u, const undoRecord *r);
+
+/* Close the step, cx, cy is the cursor after it */
+void undoEnd(undoLog *u, int cx, int cy);
+
+/* Undo (or with redo, do again) one step: fn is called for each of its
+ * records, last one first when undoing. Cursor of the step is put in
+ * cx, cy. Return 0 when there is nothing to do, -1 when the step was
+ * bigger than the log so it and the ones before can not be undone */
+int undoStep(undoLog *u, int redo, void (*fn)(void *ctx, const undoRecord *r, int redo),
+             void *ctx, int *cx, int *cy);
+
+/* Steps kept in the log, the ones which can be redone too */
+int undoSteps(const undoLog *u);
+
+#endif // End UNDO_H
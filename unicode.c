@@ -5,11 +5,13 @@
    *Description : Built library for support read and write
 character
    Struct data like:
-   [1]-[2]
-    |   \
-    V    >
-    [0x41(a)][0x00EA(e^)]
-    When read each element and write out screen
+   buf: [h][e][l][l][ gap ......... ][o][ ][w][ê]
+                     ^gapStart       ^gapEnd
+    Characters are stored as raw UTF-8 bytes in one contiguous
+    buffer with a gap at the last edit point. Typing at the same place
+    only fills the gap, the buffer grows when the gap is used up.
+    The gap is always on a character boundary so a character is never
+    split in two parts.
     UTF-8 Table
     With UTF-8 first byte present number of bytes when read bit 1 on first
     Bits of code point | First cp| Last cp | Bytes | Byte 1  | Byte 2  | Byte 3  | Byte 4  |
@@ -18,9 +20,9 @@ character
            16          | 0x0800  | 0xFFFF  | 3     |1110xxxxx|10xxxxxxx|10xxxxxxx|
            21          | 0x10000 | 0x1FFFFF| 4     |11110xxxx|10xxxxxxx|10xxxxxxx|10xxxxxxx|
 
-   TODOS: Use link-list to store
    ============================================================ */
 #include "unicode.h"
+#include "utf8.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,278 +30,381 @@ character
 #include <unistd.h>
 #include <fcntl.h>
 
+#define GAP_MIN_SIZE 16
+#define MARK_STEP 64 // Characters between two marks
 
 struct alchars {
-    achar *head;
-    int currentAt;
-    int length;
-    achar *tail;
-    achar *currentBucket;
+    char *buf;
+    int size;        // Capacity of buf
+    int gapStart;    // First byte of the gap
+    int gapEnd;      // First byte after the gap
+    int gapAt;       // Number of characters before the gap
+    int length;      // Number of characters
+    int currentAt;   // Last index looked up by getBucketAt
+    int currentByte; // Byte offset (without gap) of currentAt
+    achar bucket;    // Returned by getBucketAt
+    mpool *pool;     // Where buf comes from, NULL for system
+    int *marks;      // Byte offset of every MARK_STEP-th character
+    int marksCap;    // Capacity of marks
+    int marksValid;  // Marks from 0 which are still right
 };
 
-typedef struct buffers {
-    char *s;
-    int len;
-} buffers;
-
+/* Number of bytes of a character from its first byte */
+static int charLen(unsigned char c) {
+    if(c < 0xC0) return 1;
+    if(c < 0xE0) return 2;
+    if(c < 0xF0) return 3;
+    return 4;
+}
 
-#define INIT {NULL,0}
+static int isContinuation(unsigned char c) {
+    return (c & 0xC0) == 0x80;
+}
 
-buffers bf = INIT;
+/* Number of bytes of text, the gap is not counted */
+static int byteLen(alchars alc) {
+    return alc->size - (alc->gapEnd - alc->gapStart);
+}
 
-void refreshBuffers() {
-    if(bf.s != NULL)  {
-        free(bf.s);
-        bf.s = NULL;
-        bf.len = 0;
-    }
-    
+/* Byte offset in text to position in buffer */
+static char *physical(alchars alc, int offset) {
+    if(offset < alc->gapStart)
+        return &alc->buf[offset];
+    return &alc->buf[offset + alc->gapEnd - alc->gapStart];
 }
-/*Decode Utf-8*/
-achar *decode( unsigned codePoint) {
-    achar *chars = malloc(sizeof(achar));
 
+/*Decode Utf-8*/
+static int decode(unsigned codePoint, char *buf) {
     if(codePoint < 0x80) {
-        chars->bytes = malloc(sizeof(char));
-        chars->length = 1;
-        chars->bytes[0] = codePoint & 0xFF;
+        buf[0] = codePoint & 0xFF;
+        return 1;
     } else if (codePoint <= 0x7FF) {
-        char *buf = malloc(sizeof(char) * 2);
         buf[0] = ((codePoint >> 6) + 0xC0);
         buf[1] = ((codePoint & 0x3F) + 0x80);
-        chars->bytes = buf;
-        chars->length = 2;
+        return 2;
     } else if (codePoint <= 0xFFFF) {
-        char *buf = malloc(sizeof(char) * 3);
         buf[0] = ((codePoint >> 12) + 0xE0);
         buf[1] = (((codePoint >> 6) &0x3F) +0x80);
         buf[2] = ((codePoint & 0x3F) + 0x80);
-        chars->bytes = buf;
-        chars->length = 3;
+        return 3;
     } else if(codePoint <= 0x10FFFF) {
-        char *buf = malloc(sizeof(char) * 4);
         buf[0] = ((codePoint >> 18) + 0xF0);
         buf[1] = (((codePoint >> 12) & 0x3F) + 0x80);
         buf[2] = (((codePoint >> 6) & 0x3F) + 0x80);
         buf[3] = ((codePoint & 0x3F) + 0x80);
-        chars->bytes = buf;
-        chars->length = 4;
-    } else {
-        chars->bytes = NULL;
-        chars->length = 0;
+        return 4;
     }
-    return chars;
+    return 0;
 }
 
-/*From bytes with utf-8 format will be */
-void encode(struct alchars *alc,const char *s, int numByte) { 
-    /*When enter a string contain utf-8 char
-     * This char will be 8 byte but last byte contain data
-     * What you need to encode become utf-8
-     * So need & 0xff to get last byte*/
-    for(int i = 0; i < numByte; i++) {
-        if((unsigned char)s[i] < 0x80) {
-            appendNewChar(alc,s[i]);
-        } else if((s[i]&0xff) < 0xE0) {
-            /*Do encode*/
-            /*Check next byte is valid*/
-            if(i+1 < numByte && ((s[i+1]&0xff) & 0xC0) == 0x80) {
-                appendNewChar(alc,((s[i]&0xff) << 6) + (s[i+1] & 0xff) - 0x3080);
-                i++;
-            }
-        } else if((s[i]&0xff) < 0xF0) {
-            if(i + 1 < numByte && i + 2 < numByte) {
-                appendNewChar(alc,((s[i]&0xff) << 12) + ((s[i+1]&0xff) << 6) + (s[i+2]&0xff) - 0xE2080);
-                i+=2;
-            }
-        }else if((s[i] & 0xff) < 0xF5) {
-            if(i + 1 < numByte && i + 2 < numByte && i+3 < numByte) {
-                appendNewChar(alc,((s[i] & 0xff) << 18 )+ ((s[i+1] & 0xff) << 12) + ((s[i+2] & 0xff) << 6) + (s[i+3] & 0xff) - 0x3C82080);
-                i+=3;
-            }
-        }
+/* Length of a well formed utf-8 character at s, 0 when it is broken */
+static int validCharLen(const char *s, int numByte) {
+    unsigned char c = s[0];
+    unsigned char lo = 0x80, hi = 0xBF; // Range of second byte, as utf8.c
+    int len;
+    if(c < 0x80) return 1;
+    else if(c >= 0xC2 && c < 0xE0) len = 2;
+    else if(c >= 0xE0 && c < 0xF0) {
+        len = 3;
+        if(c == 0xE0) lo = 0xA0; // Overlong
+        if(c == 0xED) hi = 0x9F; // Surrogate
+    } else if(c >= 0xF0 && c < 0xF5) {
+        len = 4;
+        if(c == 0xF0) lo = 0x90; // Overlong
+        if(c == 0xF4) hi = 0x8F; // Above 0x10FFFF
+    } else return 0;
+
+    if(len > numByte) return 0;
+    if((unsigned char)s[1] < lo || (unsigned char)s[1] > hi) return 0;
+    for(int i = 2; i < len; i++) {
+        if(!isContinuation(s[i])) return 0;
     }
+    return len;
 }
 
-/* Append a utf-8 char*/
-void appendNewChar(alchars alc,unsigned c){
-    achar *ac = decode(c);
-    if(alc->head == NULL) {
-        alc->tail = alc->head = ac;
-        ac->previous = ac->next = NULL;
-        alc->currentBucket = alc->head;
-    }else {
-        ac->previous = alc->tail;
-        ac->next = NULL;
-
-        alc->tail->next = ac;
-        alc->tail = ac;
-
+/* Byte offset n characters after offset, byteLen when text is
+ * shorter. Both parts are scanned with the fast kernels */
+static int skipChars(alchars alc, int offset, int n) {
+    if(offset < alc->gapStart) {
+        int len = alc->gapStart - offset;
+        int r = utf8Offset(&alc->buf[offset],len,n);
+        if(r < len)
+            return offset + r;
+        n -= utf8Count(&alc->buf[offset],len);
+        offset = alc->gapStart;
     }
-    alc->length++;
+    int len = byteLen(alc) - offset;
+    if(len <= 0)
+        return offset;
+    return offset + utf8Offset(physical(alc,offset),len,n);
 }
 
-
-/* Append to struct for store string*/
-void bufAppend(buffers *buf, char *s, int len) {
-    // Add Null char
-    char *new = realloc(buf->s,buf->len + len);
-    if(new == NULL)
-        return;
-    memcpy(&new[buf->len],s,len);
-    buf->s = new;
-    buf->len += len;
+/* Number of characters starting in bytes [from, to) */
+static int countChars(alchars alc, int from, int to) {
+    int n = 0;
+    if(from < alc->gapStart) {
+        int end = to < alc->gapStart ? to : alc->gapStart;
+        n += utf8Count(&alc->buf[from],end - from);
+        from = end;
+    }
+    if(from < to)
+        n += utf8Count(physical(alc,from),to - from);
+    return n;
 }
 
-void bufFree(buffers *buf) {
-    if(buf != NULL && buf->len > 0)
-        free(buf->s);
+/* Make marks right up to mark k, return 0 when out of memory.
+ * k * MARK_STEP must not pass the length */
+static int extendMarks(alchars alc, int k) {
+    if(k < alc->marksValid)
+        return 1;
+    if(k >= alc->marksCap) {
+        int cap = alc->marksCap ? alc->marksCap * 2 : 8;
+        while(cap <= k)
+            cap *= 2;
+        int *marks = poolRealloc(alc->pool,alc->marks,
+                                 alc->marksCap * sizeof(int),cap * sizeof(int));
+        if(marks == NULL)
+            return 0;
+        alc->marks = marks;
+        alc->marksCap = cap;
+    }
+    if(alc->marksValid == 0) {
+        alc->marks[0] = 0;
+        alc->marksValid = 1;
+    }
+    while(alc->marksValid <= k) {
+        int i = alc->marksValid;
+        alc->marks[i] = skipChars(alc,alc->marks[i - 1],MARK_STEP);
+        alc->marksValid++;
+    }
+    return 1;
 }
 
-alchars newChar(void) {
-    alchars alc = malloc(sizeof(struct alchars));
-    alc->head = alc->tail = NULL;
-    alc->length = 0;
-    alc->currentAt = 0;
-    alc->currentBucket = alc->head;
-    return alc;
+/* Text changed from character at, marks after it moved */
+static void dropMarks(alchars alc, int at) {
+    if(alc->marksValid > at / MARK_STEP + 1)
+        alc->marksValid = at / MARK_STEP + 1;
 }
 
+/* Find byte offset of character at index, start from the nearest
+ * position we already know: head, gap, last lookup or tail. On long
+ * text a mark is never more than MARK_STEP characters away */
+static int byteOffsetOf(alchars alc, int index) {
+    int at = 0, offset = 0;
+    int best = index;
+
+    if(abs(index - alc->gapAt) < best) {
+        best = abs(index - alc->gapAt);
+        at = alc->gapAt;
+        offset = alc->gapStart;
+    }
+    if(abs(index - alc->currentAt) < best) {
+        best = abs(index - alc->currentAt);
+        at = alc->currentAt;
+        offset = alc->currentByte;
+    }
+    if(alc->length - index < best) {
+        best = alc->length - index;
+        at = alc->length;
+        offset = byteLen(alc);
+    }
+    if(best > MARK_STEP && extendMarks(alc,index / MARK_STEP)) {
+        at = index / MARK_STEP * MARK_STEP;
+        offset = alc->marks[index / MARK_STEP];
+    }
 
-achar *getBucketAt(alchars alc,int index) {
-    if(index >= alc->length)
-        return NULL;
-    if(index == 0) {
-        alc->currentAt = 0;
-        alc->currentBucket = alc->head;
-        return alc->head;
+    if(at < index)
+        return skipChars(alc,offset,index - at);
+    while(at > index) {
+        do {
+            offset--;
+        } while(isContinuation(*physical(alc,offset)));
+        at--;
     }
-    if(alc->currentAt == index) {
-        return alc->currentBucket;
-    } else if(alc->currentAt < index) {
-        while(alc->currentAt < index) {
-            alc->currentBucket = alc->currentBucket->next;
-            alc->currentAt++;
-        }
-        return alc->currentBucket;
-    } else {
-        while(alc->currentAt > index) {
-            alc->currentBucket = alc->currentBucket->previous;
-            alc->currentAt--;
-        }
-        return alc->currentBucket;
+    return offset;
+}
 
+/* Move the gap to before character at index */
+static void moveGap(alchars alc, int index) {
+    if(index == alc->gapAt)
+        return;
+    int offset = byteOffsetOf(alc,index);
+    if(offset < alc->gapStart) {
+        int n = alc->gapStart - offset;
+        memmove(&alc->buf[alc->gapEnd - n], &alc->buf[offset], n);
+        alc->gapEnd -= n;
+        alc->gapStart -= n;
+    } else if(offset > alc->gapStart) {
+        int n = offset - alc->gapStart;
+        memmove(&alc->buf[alc->gapStart], &alc->buf[alc->gapEnd], n);
+        alc->gapStart += n;
+        alc->gapEnd += n;
     }
+    alc->gapAt = index;
 }
 
-void insertChar(alchars alc, int at,unsigned c) {
+/* Make sure the gap can hold need bytes */
+static void growGap(alchars alc, int need) {
+    if(alc->gapEnd - alc->gapStart >= need)
+        return;
+    int tail = alc->size - alc->gapEnd;
+    int size = alc->size * 2;
+    if(alc->size == 0)
+        size = need; // Text loaded into a row fits exactly, most are never edited
+    else if(size < byteLen(alc) + need + GAP_MIN_SIZE)
+        size = byteLen(alc) + need + GAP_MIN_SIZE;
+
+    char *new = poolRealloc(alc->pool,alc->buf,alc->size,size);
+    if(new == NULL)
+        return;
+    memmove(&new[size - tail], &new[alc->gapEnd], tail);
+    alc->buf = new;
+    alc->gapEnd = size - tail;
+    alc->size = size;
+}
 
-    achar *ac = decode(c);
-    // Insert into head of list
-    if(at <= 0) {
-        ac->next = alc->head;
-        ac->previous = NULL;
+/* Text changed so the lookup cache is moved to the gap */
+static void resetCurrent(alchars alc) {
+    alc->currentAt = alc->gapAt;
+    alc->currentByte = alc->gapStart;
+}
 
-        alc->head->previous = ac;
-        alc->head = ac;
+static void insertBytes(alchars alc, int at, const char *s, int len, int count) {
+    moveGap(alc,at);
+    growGap(alc,len);
+    if(alc->gapEnd - alc->gapStart < len)
+        return;
+    memcpy(&alc->buf[alc->gapStart], s, len);
+    dropMarks(alc,at);
+    alc->gapStart += len;
+    alc->gapAt += count;
+    alc->length += count;
+    resetCurrent(alc);
+}
 
-        alc->currentAt++;
+static void deleteRange(alchars alc, int from, int count) {
+    moveGap(alc,from);
+    int n = 0;
+    for(int i = 0; i < count; i++) {
+        n += charLen(alc->buf[alc->gapEnd + n]);
     }
-    // Insert into tail of list
-    else if(at >= alc->length) {
-        ac->previous = alc->tail;
-        ac->next = NULL;
-
-        alc->tail->next = ac;
-        alc->tail = ac;
-    } else {
-       achar *temp = getBucketAt(alc,at); 
-       achar *prevTemp = temp->previous;
+    alc->gapEnd += n;
+    alc->length -= count;
+    dropMarks(alc,from);
+    resetCurrent(alc);
+}
 
-       // Connect previous bucket
-       ac->previous = prevTemp;
-       prevTemp->next = ac;
+/* Put utf-8 bytes before character at */
+static void encodeAt(alchars alc, int at, const char *s, int numByte) {
+    /* Copy well formed characters straight into the gap,
+     * broken bytes are dropped */
+    if(numByte <= 0)
+        return;
+    moveGap(alc,at);
+    growGap(alc,numByte);
+    if(alc->gapEnd - alc->gapStart < numByte)
+        return;
 
-       // Connect to current bucket
-       ac->next = temp;
-       temp->previous = ac;
+    char *dst = &alc->buf[alc->gapStart];
+    int count = 0;
+    if(utf8Validate(s,numByte)) {
+        // Usual case, whole text is good so copy it at once
+        memcpy(dst,s,numByte);
+        dst += numByte;
+        count = utf8Count(s,numByte);
+    } else {
+        for(int i = 0; i < numByte;) {
+            int len = validCharLen(&s[i],numByte - i);
+            if(len == 0) {
+                i++;
+                continue;
+            }
+            memcpy(dst,&s[i],len);
+            dst += len;
+            i += len;
+            count++;
+        }
     }
-    alc->length++;
-
+    dropMarks(alc,at);
+    alc->gapStart = dst - alc->buf;
+    alc->gapAt += count;
+    alc->length += count;
+    resetCurrent(alc);
 }
 
-void freeAchar(achar *ac) {
-    free(ac->bytes);
-    free(ac);
+/*From bytes with utf-8 format will be */
+void encode(struct alchars *alc,const char *s, int numByte) {
+    encodeAt(alc,alc->length,s,numByte);
 }
 
-void freeAllBucket(alchars alc) {
-    while(alc->tail) {
-        achar *temp = alc->tail;
-        alc->tail = alc->tail->previous;
-        freeAchar(temp);
-    }
+/* Append a utf-8 char*/
+void appendNewChar(alchars alc,unsigned c){
+    insertChar(alc,alc->length,c);
 }
-void freeChars(alchars alc) {
-    freeAllBucket(alc);
-    free(alc);
+
+alchars newChar(void) {
+    return newCharInPool(NULL);
 }
-void deleteBucketAt(alchars alc, int index) {
-    if(index < 0 && index >= alc->length) 
-        return;
 
-    if(index == 0) {
-        achar *temp = alc->head;
-        alc->head = temp->next;
-        alc->head->previous = NULL;
-        freeAchar(temp);
+alchars newCharInPool(mpool *pool) {
+    alchars alc = poolAlloc(pool,sizeof(struct alchars));
+    alc->pool = pool;
+    alc->buf = NULL;
+    alc->size = 0;
+    alc->gapStart = alc->gapEnd = 0;
+    alc->gapAt = 0;
+    alc->length = 0;
+    alc->currentAt = 0;
+    alc->currentByte = 0;
+    alc->bucket.bytes = NULL;
+    alc->bucket.length = 0;
+    alc->marks = NULL;
+    alc->marksCap = 0;
+    alc->marksValid = 0;
+    return alc;
+}
 
-        if(alc->currentAt == 0) {
-            alc->currentBucket = alc->head;
-        } else {
-            alc->currentAt--;
-        }
-    } else if(index == alc->length - 1) {
-        achar *temp = alc->tail;
-        alc->tail = temp->previous;
-        alc->tail->next = NULL;
-        freeAchar(temp);
-
-        if(alc->currentAt == alc->length - 1) {
-            alc->currentAt--;
-            alc->currentBucket = alc->tail;
-        }
-    } else {
-        achar *temp = getBucketAt(alc,index); 
 
-        achar *prevTemp = temp->previous;
-        achar *nextTemp = temp->next;
+achar *getBucketAt(alchars alc,int index) {
+    if(index < 0 || index >= alc->length)
+        return NULL;
+    int offset = byteOffsetOf(alc,index);
+    alc->currentAt = index;
+    alc->currentByte = offset;
 
-        nextTemp->previous = prevTemp;
-        prevTemp->next = nextTemp;
+    alc->bucket.bytes = physical(alc,offset);
+    alc->bucket.length = charLen(alc->bucket.bytes[0]);
+    return &alc->bucket;
+}
 
-        alc->currentBucket = nextTemp;
+void insertChar(alchars alc, int at,unsigned c) {
+    char buf[4];
+    int len = decode(c,buf);
+    if(len == 0)
+        return;
 
-        freeAchar(temp);
-    }
+    if(at < 0) at = 0;
+    if(at > alc->length) at = alc->length;
+    insertBytes(alc,at,buf,len,1);
+}
 
-    alc->length--;
-    if(alc->length == 0) {
-        alc->currentAt = 0;
-        alc->currentBucket = NULL;
-        alc->head = NULL;
-        alc->tail = NULL;
-    } 
+void insertString(alchars alc, int at, const char *s, int len) {
+    if(at < 0) at = 0;
+    if(at > alc->length) at = alc->length;
+    encodeAt(alc,at,s,len);
 }
 
-void deleteFromBucketTo(achar *fromBucket, achar *toBucket) {
-    while(fromBucket != toBucket)  {
-        achar *temp = fromBucket;
-        fromBucket = fromBucket->next;
-        freeAchar(temp);
-    }
-    freeAchar(toBucket);
+void freeChars(alchars alc) {
+    poolFree(alc->pool,alc->marks,alc->marksCap * sizeof(int));
+    poolFree(alc->pool,alc->buf,alc->size);
+    poolFree(alc->pool,alc,sizeof(struct alchars));
+}
+void deleteBucketAt(alchars alc, int index) {
+    if(index < 0 || index >= alc->length)
+        return;
+    deleteRange(alc,index,1);
 }
+
 void deleteBuckets(alchars alc,int from, int to) {
     int len = getLen(alc);
     // Change suitable index
@@ -310,107 +415,339 @@ void deleteBuckets(alchars alc,int from, int to) {
         to = len - 1;
     }
 
-    if(to < from)
+    if(from < 0 || to < from)
         return;
 
-    // Check if delete all buckets
-    if(from == 0 && to == len - 1) {
-        freeAllBucket(alc);
-        alc->tail = alc->head = NULL;
-        alc->currentAt = 0;
-        alc->currentBucket = NULL;
-        alc->length = 0;
-        return;
+    deleteRange(alc,from,to - from + 1);
+}
+
+const char *getStringPointer(alchars alc) {
+    // Push the gap to the tail so the text is contiguous
+    moveGap(alc,alc->length);
+    growGap(alc,1);
+    if(alc->buf == NULL)
+        return "";
+    alc->buf[alc->gapStart] = '\0';
+    return alc->buf;
+}
+
+char *getString(alchars alc) {
+    int before = alc->gapStart;
+    int after = alc->size - alc->gapEnd;
+    char *str = malloc(before + after + 1);
+    if(str == NULL)
+        return NULL;
+    if(before)
+        memcpy(str,alc->buf,before);
+    if(after)
+        memcpy(&str[before],&alc->buf[alc->gapEnd],after);
+    str[before + after] = '\0';
+    return str;
+}
+
+void getSegments(alchars alc,const char **first,int *firstLen,
+                 const char **second,int *secondLen) {
+    *first = alc->buf;
+    *firstLen = alc->gapStart;
+    *second = alc->buf ? &alc->buf[alc->gapEnd] : NULL;
+    *secondLen = alc->size - alc->gapEnd;
+}
+
+int getLen(alchars alc) {
+    return alc->length;
+}
+
+int getByteOffset(alchars alc, int index) {
+    if(index <= 0)
+        return 0;
+    if(index >= alc->length)
+        return byteLen(alc);
+    return byteOffsetOf(alc,index);
+}
+
+int getIndexOfByte(alchars alc, int offset) {
+    if(offset <= 0)
+        return 0;
+    if(offset >= byteLen(alc))
+        return alc->length;
+
+    // Nearest known position before offset
+    int at = 0, from = 0;
+    if(alc->gapStart <= offset) {
+        at = alc->gapAt;
+        from = alc->gapStart;
+    }
+    if(alc->currentByte <= offset && alc->currentByte > from) {
+        at = alc->currentAt;
+        from = alc->currentByte;
     }
 
-    // Head segment
-    if(from == 0) {
-        achar *toBucket = getBucketAt(alc,to);
-        achar *nextToBucket = toBucket->next;
-        deleteFromBucketTo(alc->head,toBucket);
-        alc->head = nextToBucket;
-        alc->head->previous = NULL;
-
-        // Refresh current index
-        if(alc->currentAt > to) {
-            alc->currentAt -= (to - from + 1);
-        } else {
-            alc->currentAt = 0;
-            alc->currentBucket = alc->head;
+    if(offset - from > MARK_STEP) {
+        // Marks until one passes offset, then the last one before it
+        int last = alc->length / MARK_STEP;
+        while(alc->marksValid <= last &&
+              (alc->marksValid == 0 || alc->marks[alc->marksValid - 1] <= offset)) {
+            if(!extendMarks(alc,alc->marksValid))
+                break;
+        }
+        int lo = 0, hi = alc->marksValid - 1;
+        while(lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if(alc->marks[mid] <= offset) lo = mid;
+            else hi = mid - 1;
+        }
+        if(alc->marksValid > 0 && alc->marks[lo] > from) {
+            at = lo * MARK_STEP;
+            from = alc->marks[lo];
         }
+    }
+    // Count the character holding offset, then step back to its index
+    return at + countChars(alc,from,offset + 1) - 1;
+}
 
-    } else if (to == len - 1) {
-        achar *fromBucket = getBucketAt(alc,from);
-        achar *previousFromBucket = fromBucket->previous;
-        previousFromBucket->next = NULL;
+/* Add new string */
+void appendNewString(alchars alc,const char *s) {
+    encode(alc,s,strlen(s));
+}
 
-        deleteFromBucketTo(fromBucket,alc->tail);
-        alc->tail = previousFromBucket;
+void appendNewStringWithLen(alchars alc,const char *s,int len) {
+    encode(alc,s,len);
+}
+int getStringLen(const char *s) {
+    int numByte = strlen(s);
+    if(utf8Validate(s,numByte))
+        return utf8Count(s,numByte);
 
-        // Refresh current index
-        if(alc->currentAt > from) {
-            alc->currentAt = from - 1;
-        } else {
-            alc->currentBucket = alc->tail;
+    int len = 0;
+    for(int i = 0; i < numByte;) {
+        int n = validCharLen(&s[i],numByte - i);
+        if(n == 0) {
+            i++;
+            continue;
         }
+        i += n;
+        len++;
+    }
+    return len;
+}
 
-    } else {
-        achar *fromBucket = getBucketAt(alc,from);
-        achar *toBucket = getBucketAt(alc,to);
-
-        // Delete buckets
-        achar *previousFromBucket = fromBucket->previous;
-        achar *nextToBucket = toBucket->next;
-        
-        previousFromBucket->next = nextToBucket;
-        nextToBucket->previous = previousFromBucket;
-
-        deleteFromBucketTo(fromBucket,toBucket);
-        if(alc->currentAt > to) {
-            alc->currentAt -= (to - from + 1);
-        } else if(alc->currentAt >= from && alc->currentAt <= to) {
-            alc->currentAt = from -  1;
-            alc->currentBucket = previousFromBucket;
+/* Canonical normalization. Text is copied as it is while characters
+ * stay the same in the form, the rest is cut in short chunks which
+ * end before a stable character and each chunk is decomposed, put in
+ * canonical order and for NFC composed again in a buffer on the stack */
+#include "normaltab.h"
+
+#if NORM_MAX_GROWTH > NORM_GROWTH
+#error "normalized text grows more than NORM_GROWTH"
+#endif
+
+#define NORM_NFD_NO 0x100    // Has a decomposition
+#define NORM_NFC_NO 0x200    // Never in NFC
+#define NORM_NFC_MAYBE 0x400 // May join the character before in NFC
+#define NORM_CHUNK 64        // Code points of a chunk, a longer run of marks is cut
+#define NORM_MAX_DECOMP 4
+
+#define HANGUL_S 0xAC00
+#define HANGUL_L 0x1100
+#define HANGUL_V 0x1161
+#define HANGUL_T 0x11A7
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_COUNT 11172
+
+static unsigned normInfo(unsigned cp) {
+    if(cp >= 0x110000) return 0;
+    return normStage2[normStage1[cp / NORM_BLOCK] * NORM_BLOCK + cp % NORM_BLOCK];
+}
+
+/* Character which is the same in form and no character after it
+ * changes it */
+static int normStable(int form, unsigned info) {
+    if(form == NORM_NFD) return !(info & (0xFF | NORM_NFD_NO));
+    return !(info & (0xFF | NORM_NFC_NO | NORM_NFC_MAYBE));
+}
+
+/* Code point at s and its length in n, -1 for a broken byte */
+static long readCodePoint(const char *s, size_t len, int *n) {
+    *n = validCharLen(s, len > 4 ? 4 : (int)len);
+    if(*n == 0) {
+        *n = 1;
+        return -1;
+    }
+    unsigned char c = s[0];
+    if(*n == 1) return c;
+    long cp = c & (0x7F >> *n);
+    for(int i = 1; i < *n; i++)
+        cp = (cp << 6) | (s[i] & 0x3F);
+    return cp;
+}
+
+/* Bytes at the start of s which stay the same. In NFC the stable
+ * character before the first unstable one is left out, the marks
+ * after it may join it */
+static size_t normFast(int form, const char *s, size_t len) {
+    size_t i = 0, last = 0;
+    while(i < len) {
+        size_t ascii = utf8AsciiPrefix(&s[i], len - i);
+        if(ascii) {
+            i += ascii;
+            last = i - 1;
+            continue;
         }
+        int n;
+        long cp = readCodePoint(&s[i], len - i, &n);
+        if(cp >= 0 && !normStable(form, normInfo(cp))) break;
+        last = i;
+        i += n;
     }
-    
-    alc->length -= (to - from + 1);
+    if(i < len && form == NORM_NFC) return i > 0 ? last : 0;
+    return i;
+}
 
+static int cmpDecomp(const void *key, const void *item) {
+    unsigned cp = *(const unsigned *)key, other = *(const unsigned *)item;
+    return cp < other ? -1 : cp > other;
 }
-char *getString(alchars alc) {
-    char *str = malloc(sizeof(char)); 
-    int len = 0;
-    achar *temp = alc->head;
-    while(temp) {
-        str= realloc(str,len + temp->length);
-        memcpy(&str[len],temp->bytes,temp->length);
 
-        len+=temp->length;
+static int cmpCompose(const void *key, const void *item) {
+    const unsigned *a = key, *b = item;
+    if(a[0] != b[0]) return a[0] < b[0] ? -1 : 1;
+    return a[1] < b[1] ? -1 : a[1] > b[1];
+}
 
-        temp = temp->next;
+/* Put the full decomposition of cp in out, return its count */
+static int decompose(unsigned cp, unsigned info, unsigned *out) {
+    if(cp - HANGUL_S < HANGUL_COUNT) {
+        unsigned s = cp - HANGUL_S;
+        out[0] = HANGUL_L + s / (HANGUL_V_COUNT * HANGUL_T_COUNT);
+        out[1] = HANGUL_V + s % (HANGUL_V_COUNT * HANGUL_T_COUNT) / HANGUL_T_COUNT;
+        if(s % HANGUL_T_COUNT == 0) return 2;
+        out[2] = HANGUL_T + s % HANGUL_T_COUNT;
+        return 3;
     }
-    str= realloc(str,len + 1);
-    str[len] = '\0';
-    return str;
+    if(info & NORM_NFD_NO) {
+        const unsigned *d = bsearch(&cp, normDecomp, sizeof(normDecomp) / sizeof(normDecomp[0]),
+                                    sizeof(normDecomp[0]), cmpDecomp);
+        if(d) {
+            memcpy(out, &normDecompChars[d[1]], d[2] * sizeof(unsigned));
+            return d[2];
+        }
+    }
+    out[0] = cp;
+    return 1;
 }
 
-int getLen(alchars alc) {
-    return alc->length;
+/* Character which a and b make together, 0 for none */
+static unsigned composePair(unsigned a, unsigned b) {
+    if(a - HANGUL_L < 19 && b - HANGUL_V < HANGUL_V_COUNT)
+        return HANGUL_S + ((a - HANGUL_L) * HANGUL_V_COUNT + b - HANGUL_V) * HANGUL_T_COUNT;
+    if(a - HANGUL_S < HANGUL_COUNT && (a - HANGUL_S) % HANGUL_T_COUNT == 0 &&
+       b - HANGUL_T - 1 < HANGUL_T_COUNT - 1)
+        return a + b - HANGUL_T;
+    unsigned key[2] = {a, b};
+    const unsigned *c = bsearch(key, normCompose, sizeof(normCompose) / sizeof(normCompose[0]),
+                                sizeof(normCompose[0]), cmpCompose);
+    return c ? c[2] : 0;
 }
 
-/* Add new string */
-void appendNewString(alchars alc,const char *s) {
-    encode(alc,s,strlen(s));
-}
+/* Normalize the text at s up to the next stable character into out,
+ * which has room for NORM_CHUNK characters. Return bytes of s used,
+ * a broken byte is a chunk of its own */
+static size_t normChunk(int form, const char *s, size_t len, char *out, int *outLen) {
+    unsigned cps[NORM_CHUNK];
+    unsigned char cls[NORM_CHUNK];
+    int count = 0, n;
+    size_t i = 0;
+
+    while(i < len) {
+        long cp = readCodePoint(&s[i], len - i, &n);
+        if(cp < 0) {
+            if(i > 0) break;
+            out[0] = s[0];
+            *outLen = 1;
+            return 1;
+        }
+        unsigned info = normInfo(cp);
+        if(i > 0 && (normStable(form, info) || count + NORM_MAX_DECOMP > NORM_CHUNK)) break;
+        count += decompose(cp, info, &cps[count]);
+        i += n;
+    }
 
-void appendNewStringWithLen(alchars alc,const char *s,int len) {
-    encode(alc,s,len);
+    // Canonical order: marks between two starters are sorted by class
+    for(int k = 0; k < count; k++) {
+        cls[k] = normInfo(cps[k]) & 0xFF;
+        unsigned cp = cps[k];
+        unsigned char c = cls[k];
+        int j = k;
+        for(; c && j > 0 && cls[j - 1] > c; j--) {
+            cps[j] = cps[j - 1];
+            cls[j] = cls[j - 1];
+        }
+        cps[j] = cp;
+        cls[j] = c;
+    }
+
+    if(form == NORM_NFC && count > 1) {
+        int starter = cls[0] == 0 ? 0 : -1;
+        int last = cls[0] == 0 ? 0 : 256;
+        int kept = 1;
+        for(int k = 1; k < count; k++) {
+            unsigned c = cls[k];
+            // Joins the starter when nothing of the same or a higher
+            // class comes between them
+            if(starter >= 0 && (last < (int)c || last == 0)) {
+                unsigned joined = composePair(cps[starter], cps[k]);
+                if(joined) {
+                    cps[starter] = joined;
+                    continue;
+                }
+            }
+            if(c == 0) starter = kept;
+            last = c;
+            cps[kept] = cps[k];
+            cls[kept++] = c;
+        }
+        count = kept;
+    }
+
+    *outLen = 0;
+    for(int k = 0; k < count; k++)
+        *outLen += decode(cps[k], &out[*outLen]);
+    return i;
 }
-int getStringLen(const char *s) {
-    alchars alc = newChar();
-    encode(alc,s,strlen(s));
-    int len = alc->length;
 
-    freeChars(alc);
+size_t normalizeSpan(int form, const char *s, size_t len) {
+    char buf[NORM_CHUNK * 4];
+    size_t i = 0;
+    if(form != NORM_NFC && form != NORM_NFD) return len;
+    while(i < len) {
+        i += normFast(form, &s[i], len - i);
+        if(i == len) break;
+        int n;
+        size_t used = normChunk(form, &s[i], len - i, buf, &n);
+        if((size_t)n != used || memcmp(buf, &s[i], n) != 0) return i;
+        i += used;
+    }
     return len;
 }
+
+size_t normalizeText(int form, const char *s, size_t len, char *out, size_t cap) {
+    char buf[NORM_CHUNK * 4];
+    size_t i = 0, n = 0;
+    if(form != NORM_NFC && form != NORM_NFD) {
+        if(len <= cap) memcpy(out, s, len);
+        return len;
+    }
+    while(i < len) {
+        size_t same = normFast(form, &s[i], len - i);
+        if(n + same <= cap) memcpy(&out[n], &s[i], same);
+        n += same;
+        i += same;
+        if(i == len) break;
+        int made;
+        i += normChunk(form, &s[i], len - i, buf, &made);
+        if(n + made <= cap) memcpy(&out[n], buf, made);
+        n += made;
+    }
+    return n;
+}
@@ -7,21 +7,30 @@
 #ifndef UNICODE_H
 #define UNICODE_H
 
+#include "mem.h"
+
+/* A character viewed in place, bytes point into the text storage
+ * and stay valid until the text is modified */
 typedef struct achar achar;
 struct achar {
     char *bytes;
     int length;
-    achar *next;
-    achar *previous;
 };
 
 typedef struct alchars *alchars; // Definition to itselft
 
 alchars newChar();
+
+/* New chars, text storage comes from pool */
+alchars newCharInPool(mpool *pool);
 /* Add new char*/
 void appendNewChar(alchars alc,unsigned c);
 
 void insertChar(alchars alc, int at,unsigned c);
+
+/* Insert utf-8 text s with len bytes before character at, broken
+ * bytes are dropped */
+void insertString(alchars alc, int at, const char *s, int len);
 /* Add new string */
 void appendNewString(alchars alc,const char *s);
 
@@ -31,17 +40,29 @@ void appendNewStringWithLen(alchars alc,const char *s,int len);
 /* Free chars*/
 void freeChars(alchars alc);
 
-/* Get string */
+/* Get string, the pointer is valid until next modification*/
 const char *getStringPointer(alchars alc);
 
 char *getString(alchars alc);
 
+/* Get text in place as two parts, before and after the edit point.
+ * Pointers are valid until next modification*/
+void getSegments(alchars alc,const char **first,int *firstLen,
+                 const char **second,int *secondLen);
+
 /* Get string length*/
 int getStringLen(const char *s);
 
 /* Get length buckets*/
 int getLen(alchars alc);
 
+/* Byte offset of character at index, index at the end gives the
+ * number of bytes. Near constant time, also on long text */
+int getByteOffset(alchars alc, int index);
+
+/* Index of character holding byte at offset */
+int getIndexOfByte(alchars alc, int offset);
+
 /* Get string value of bucket at index*/
 achar *getBucketAt(alchars alc,int index);
 
@@ -51,4 +72,19 @@ void deleteBucketAt(alchars alc, int index);
 /* Delete buckets from a to b index*/
 void deleteBuckets(alchars,int from, int to);
 
+#define NORM_GROWTH 3 // Bytes of normalized text per byte of source
+
+enum normForm {
+    NORM_NONE = 0,
+    NORM_NFC,
+    NORM_NFD
+};
+
+/* Bytes at the start of s which are already in form */
+size_t normalizeSpan(int form, const char *s, size_t len);
+
+/* Put s in form into out. Return the length of the result, which is
+ * at most NORM_GROWTH * len; out is only whole when it fits cap */
+size_t normalizeText(int form, const char *s, size_t len, char *out, size_t cap);
+
 #endif // End UNICODE_H
@@ -0,0 +1,423 @@
+/* ============================================================
+   *File : utf8.c
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Kernels work on 16 (SSE2) or 32 (AVX2) bytes at
+   once:
+   - ASCII: a block is ASCII when no byte has its high bit
+   - Count: a byte starts a character when it is not 10xxxxxx,
+     as signed char that is every byte > -65 (0xBF)
+   - Offset: count blocks until the block which holds character n
+   - Validate: AVX2 uses lookup tables on the high and low nibbles
+     of each byte and the byte before it (Keiser and Lemire,
+     "Validating UTF-8 In Less Than One Instruction Per Byte").
+     SSE2 has no byte shuffle so it only skips ASCII blocks and
+     checks other characters one by one.
+   Best kernel is picked once, on the first call of any thread.
+   ============================================================ */
+#include "utf8.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define UTF8_X86 1
+#include <immintrin.h>
+#endif
+
+typedef struct utf8Ops {
+    size_t (*asciiPrefix)(const char *s, size_t len);
+    int (*validate)(const char *s, size_t len);
+    size_t (*count)(const char *s, size_t len);
+    size_t (*offset)(const char *s, size_t len, size_t n);
+} utf8Ops;
+
+static int kernel = -1;
+static utf8Ops ops;
+
+/*** scalar ***/
+
+static int isContinuation(unsigned char c) {
+    return (c & 0xC0) == 0x80;
+}
+
+/* Length of a well formed character at s, 0 when it is not */
+static size_t validCharLen(const unsigned char *s, size_t len) {
+    unsigned char c = s[0];
+    unsigned char lo = 0x80, hi = 0xBF; // Range of second byte
+    size_t n;
+
+    if(c < 0x80) return 1;
+    if(c >= 0xC2 && c <= 0xDF) n = 2;
+    else if(c >= 0xE0 && c <= 0xEF) {
+        n = 3;
+        if(c == 0xE0) lo = 0xA0; // Overlong
+        if(c == 0xED) hi = 0x9F; // Surrogate
+    } else if(c >= 0xF0 && c <= 0xF4) {
+        n = 4;
+        if(c == 0xF0) lo = 0x90; // Overlong
+        if(c == 0xF4) hi = 0x8F; // Above 0x10FFFF
+    } else return 0;
+
+    if(len < n) return 0;
+    if(s[1] < lo || s[1] > hi) return 0;
+    for(size_t i = 2; i < n; i++) {
+        if(!isContinuation(s[i])) return 0;
+    }
+    return n;
+}
+
+static size_t asciiPrefixScalar(const char *s, size_t len) {
+    size_t i = 0;
+    while(i < len && (unsigned char)s[i] < 0x80) i++;
+    return i;
+}
+
+static int validateScalar(const char *s, size_t len) {
+    const unsigned char *p = (const unsigned char *)s;
+    size_t i = 0;
+    while(i < len) {
+        size_t n = validCharLen(&p[i], len - i);
+        if(n == 0) return 0;
+        i += n;
+    }
+    return 1;
+}
+
+static size_t countScalar(const char *s, size_t len) {
+    size_t count = 0;
+    for(size_t i = 0; i < len; i++) {
+        if(!isContinuation(s[i])) count++;
+    }
+    return count;
+}
+
+static size_t offsetScalar(const char *s, size_t len, size_t n) {
+    for(size_t i = 0; i < len; i++) {
+        if(!isContinuation(s[i])) {
+            if(n == 0) return i;
+            n--;
+        }
+    }
+    return len;
+}
+
+#ifdef UTF8_X86
+
+/* Position of bit n (from 0) of the set bits in mask */
+static int nthBit(unsigned mask, size_t n) {
+    while(n--) mask &= mask - 1;
+    return __builtin_ctz(mask);
+}
+
+/*** SSE2 ***/
+
+__attribute__((target("sse2")))
+static size_t asciiPrefixSse2(const char *s, size_t len) {
+    size_t i = 0;
+    for(; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&s[i]);
+        int mask = _mm_movemask_epi8(v);
+        if(mask) return i + __builtin_ctz(mask);
+    }
+    return i + asciiPrefixScalar(&s[i], len - i);
+}
+
+__attribute__((target("sse2")))
+static int validateSse2(const char *s, size_t len) {
+    const unsigned char *p = (const unsigned char *)s;
+    size_t i = 0;
+    while(i < len) {
+        i += asciiPrefixSse2(&s[i], len - i);
+        if(i >= len) break;
+        size_t n = validCharLen(&p[i], len - i);
+        if(n == 0) return 0;
+        i += n;
+    }
+    return 1;
+}
+
+__attribute__((target("sse2")))
+static size_t countSse2(const char *s, size_t len) {
+    const __m128i cont = _mm_set1_epi8(-65);
+    size_t count = 0;
+    size_t i = 0;
+    for(; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&s[i]);
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(v, cont)));
+    }
+    return count + countScalar(&s[i], len - i);
+}
+
+__attribute__((target("sse2")))
+static size_t offsetSse2(const char *s, size_t len, size_t n) {
+    const __m128i cont = _mm_set1_epi8(-65);
+    size_t i = 0;
+    for(; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&s[i]);
+        unsigned mask = _mm_movemask_epi8(_mm_cmpgt_epi8(v, cont));
+        size_t c = __builtin_popcount(mask);
+        if(n < c) return i + nthBit(mask, n);
+        n -= c;
+    }
+    size_t r = offsetScalar(&s[i], len - i, n);
+    return i + r;
+}
+
+/*** AVX2 ***/
+
+#define TOO_SHORT      (1 << 0) // Lead byte not followed by continuation
+#define TOO_LONG       (1 << 1) // Continuation after ASCII
+#define OVERLONG_3     (1 << 2)
+#define TOO_LARGE      (1 << 3)
+#define SURROGATE      (1 << 4)
+#define OVERLONG_2     (1 << 5)
+#define TOO_LARGE_1000 (1 << 6)
+#define OVERLONG_4     (1 << 6)
+#define TWO_CONTS      (1 << 7) // Continuation after continuation
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+/* Errors by high nibble of the byte before */
+static const unsigned char byte1High[16] = {
+    // 0_______ ASCII
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    // 10______ continuation
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    // 1100____ two bytes lead
+    TOO_SHORT | OVERLONG_2,
+    // 1101____ two bytes lead
+    TOO_SHORT,
+    // 1110____ three bytes lead
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    // 1111____ four bytes lead
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+/* Errors by low nibble of the byte before */
+static const unsigned char byte1Low[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, // ____0000
+    CARRY | OVERLONG_2,                           // ____0001
+    CARRY,                                        // ____001_
+    CARRY,
+    CARRY | TOO_LARGE,                            // ____0100
+    CARRY | TOO_LARGE | TOO_LARGE_1000,           // ____0101
+    CARRY | TOO_LARGE | TOO_LARGE_1000,           // ____011_
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,           // ____1___
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, // ____1101
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+/* Errors by high nibble of the byte itself */
+static const unsigned char byte2High[16] = {
+    // 0_______ ASCII
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    // 1000____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    // 1001____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    // 101_____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    // 11______ lead
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+/* Last bytes of a block which start a character not finished in it */
+static const unsigned char incompleteMax[32] = {
+    255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+typedef struct avx2State {
+    __m256i error;
+    __m256i prevInput;
+    __m256i prevIncomplete;
+    __m256i t1High, t1Low, t2High, nibble, incomplete;
+} avx2State;
+
+__attribute__((target("avx2")))
+static __m256i highNibble(__m256i v, __m256i mask) {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), mask);
+}
+
+__attribute__((target("avx2")))
+static void checkBlockAvx2(avx2State *st, __m256i input) {
+    if(_mm256_movemask_epi8(input) == 0) {
+        // ASCII block, only a character left open before is wrong
+        st->error = _mm256_or_si256(st->error, st->prevIncomplete);
+        st->prevIncomplete = _mm256_setzero_si256();
+        st->prevInput = input;
+        return;
+    }
+
+    // Bytes shifted by 1, 2, 3 with the end of the block before
+    __m256i carried = _mm256_permute2x128_si256(st->prevInput, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, carried, 16 - 1);
+    __m256i prev2 = _mm256_alignr_epi8(input, carried, 16 - 2);
+    __m256i prev3 = _mm256_alignr_epi8(input, carried, 16 - 3);
+
+    __m256i sc = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(st->t1High, highNibble(prev1, st->nibble)),
+            _mm256_shuffle_epi8(st->t1Low, _mm256_and_si256(prev1, st->nibble))),
+        _mm256_shuffle_epi8(st->t2High, highNibble(input, st->nibble)));
+
+    // Third and fourth bytes must be continuation
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                      _mm256_set1_epi8((char)0x80));
+
+    st->error = _mm256_or_si256(st->error, _mm256_xor_si256(must23, sc));
+    st->prevIncomplete = _mm256_subs_epu8(input, st->incomplete);
+    st->prevInput = input;
+}
+
+__attribute__((target("avx2")))
+static int validateAvx2(const char *s, size_t len) {
+    avx2State st;
+    st.error = _mm256_setzero_si256();
+    st.prevInput = _mm256_setzero_si256();
+    st.prevIncomplete = _mm256_setzero_si256();
+    st.t1High = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte1High));
+    st.t1Low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte1Low));
+    st.t2High = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)byte2High));
+    st.nibble = _mm256_set1_epi8(0x0F);
+    st.incomplete = _mm256_loadu_si256((const __m256i *)incompleteMax);
+
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+        checkBlockAvx2(&st, _mm256_loadu_si256((const __m256i *)&s[i]));
+    }
+    if(i < len) {
+        // Pad the tail with zero, zero is ASCII
+        char tail[32];
+        memset(tail, 0, sizeof(tail));
+        memcpy(tail, &s[i], len - i);
+        checkBlockAvx2(&st, _mm256_loadu_si256((const __m256i *)tail));
+    }
+    st.error = _mm256_or_si256(st.error, st.prevIncomplete);
+    return _mm256_testz_si256(st.error, st.error);
+}
+
+__attribute__((target("avx2")))
+static size_t asciiPrefixAvx2(const char *s, size_t len) {
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)&s[i]);
+        unsigned mask = _mm256_movemask_epi8(v);
+        if(mask) return i + __builtin_ctz(mask);
+    }
+    return i + asciiPrefixScalar(&s[i], len - i);
+}
+
+__attribute__((target("avx2")))
+static size_t countAvx2(const char *s, size_t len) {
+    const __m256i cont = _mm256_set1_epi8(-65);
+    size_t count = 0;
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)&s[i]);
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(v, cont));
+        count += __builtin_popcount(mask);
+    }
+    return count + countScalar(&s[i], len - i);
+}
+
+__attribute__((target("avx2")))
+static size_t offsetAvx2(const char *s, size_t len, size_t n) {
+    const __m256i cont = _mm256_set1_epi8(-65);
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)&s[i]);
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(v, cont));
+        size_t c = __builtin_popcount(mask);
+        if(n < c) return i + nthBit(mask, n);
+        n -= c;
+    }
+    return i + offsetScalar(&s[i], len - i, n);
+}
+
+#endif // UTF8_X86
+
+int utf8SetKernel(int k) {
+    utf8Ops o;
+    o.asciiPrefix = asciiPrefixScalar;
+    o.validate = validateScalar;
+    o.count = countScalar;
+    o.offset = offsetScalar;
+
+    switch(k) {
+        case UTF8_SCALAR:
+            break;
+#ifdef UTF8_X86
+        case UTF8_SSE2:
+            if(!__builtin_cpu_supports("sse2")) return 0;
+            o.asciiPrefix = asciiPrefixSse2;
+            o.validate = validateSse2;
+            o.count = countSse2;
+            o.offset = offsetSse2;
+            break;
+        case UTF8_AVX2:
+            if(!__builtin_cpu_supports("avx2")) return 0;
+            o.asciiPrefix = asciiPrefixAvx2;
+            o.validate = validateAvx2;
+            o.count = countAvx2;
+            o.offset = offsetAvx2;
+            break;
+#endif
+        default:
+            return 0;
+    }
+    ops = o;
+    kernel = k;
+    return 1;
+}
+
+/* Pick the best kernel, unless one was set before */
+static void pick(void) {
+    if(kernel >= 0) return;
+    if(!utf8SetKernel(UTF8_AVX2) && !utf8SetKernel(UTF8_SSE2))
+        utf8SetKernel(UTF8_SCALAR);
+}
+
+/* Search workers and the loader may make the first call together */
+static void init(void) {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, pick);
+}
+
+int utf8GetKernel(void) {
+    init();
+    return kernel;
+}
+
+size_t utf8AsciiPrefix(const char *s, size_t len) {
+    init();
+    return ops.asciiPrefix(s, len);
+}
+
+int utf8Validate(const char *s, size_t len) {
+    init();
+    return ops.validate(s, len);
+}
+
+size_t utf8Count(const char *s, size_t len) {
+    init();
+    return ops.count(s, len);
+}
+
+size_t utf8Offset(const char *s, size_t len, size_t n) {
+    init();
+    return ops.offset(s, len, n);
+}
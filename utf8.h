@@ -0,0 +1,38 @@
+/* ============================================================
+   *File : utf8.h
+   *Date : 2026-10-17
+   *Creator : @congdv
+   *Description : Fast kernels for utf-8 text. SSE2 or AVX2 is
+   picked when program runs, scalar code gives the same results
+   ============================================================ */
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stddef.h>
+
+enum utf8Kernel {
+    UTF8_SCALAR = 0,
+    UTF8_SSE2,
+    UTF8_AVX2
+};
+
+/* Number of bytes before the first non ASCII byte */
+size_t utf8AsciiPrefix(const char *s, size_t len);
+
+/* 1 when s is well formed utf-8: no broken sequence, overlong form,
+ * surrogate or code point above 0x10FFFF */
+int utf8Validate(const char *s, size_t len);
+
+/* Number of characters, every byte which is not 10xxxxxx starts one */
+size_t utf8Count(const char *s, size_t len);
+
+/* Byte offset where character n starts, len when s is shorter */
+size_t utf8Offset(const char *s, size_t len, size_t n);
+
+/* Kernel in use */
+int utf8GetKernel(void);
+
+/* Use another kernel, return 0 when CPU does not support it */
+int utf8SetKernel(int kernel);
+
+#endif // End UTF8_H